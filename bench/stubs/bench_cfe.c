@@ -0,0 +1,181 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  Minimal implementations of the stubbed OSAL, PSP and cFE APIs
+ *
+ *  The header accessors decode the CCSDS primary and telemetry secondary
+ *  headers the way the default cFE MSG module does.
+ */
+
+#include <stdarg.h>
+#include <time.h>
+
+#include "bench_cfe.h"
+
+#define BENCH_MSG_MSGID_MASK 0x1FFF
+
+uint32 BENCH_EventCount;
+
+int32 OS_MutSemCreate(osal_id_t *Id, const char *Name, uint32 Options)
+{
+    (void)Name;
+    (void)Options;
+
+    Id->Value = 1;
+    return OS_SUCCESS;
+}
+
+int32 OS_MutSemTake(osal_id_t Id)
+{
+    (void)Id;
+    return OS_SUCCESS;
+}
+
+int32 OS_MutSemGive(osal_id_t Id)
+{
+    (void)Id;
+    return OS_SUCCESS;
+}
+
+void OS_printf(const char *Format, ...)
+{
+    va_list Args;
+
+    va_start(Args, Format);
+    vprintf(Format, Args);
+    va_end(Args);
+}
+
+bool CFE_SB_IsValidMsgId(CFE_SB_MsgId_t MsgId)
+{
+    return MsgId.Value != 0 && MsgId.Value <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID;
+}
+
+int32 CFE_SB_MessageStringGet(char *DestStringPtr, const char *SourceStringPtr, const char *DefaultString,
+                              size_t DestMaxSize, size_t SourceMaxSize)
+{
+    char *Start = DestStringPtr;
+
+    if (DestStringPtr == NULL || DestMaxSize == 0)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    if (SourceStringPtr == NULL || SourceMaxSize == 0 || *SourceStringPtr == '\0')
+    {
+        SourceStringPtr = DefaultString;
+        SourceMaxSize   = (DefaultString != NULL) ? DestMaxSize : 0;
+    }
+
+    --DestMaxSize;
+    while (SourceStringPtr != NULL && SourceMaxSize > 0 && DestMaxSize > 0 && *SourceStringPtr != '\0')
+    {
+        *DestStringPtr++ = *SourceStringPtr++;
+        --SourceMaxSize;
+        --DestMaxSize;
+    }
+    *DestStringPtr = '\0';
+
+    return (int32)(DestStringPtr - Start);
+}
+
+CFE_Status_t CFE_MSG_Init(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    memset(MsgPtr, 0, Size);
+
+    MsgPtr->CCSDS.StreamId[0] = (uint8)((MsgId.Value & BENCH_MSG_MSGID_MASK) >> 8);
+    MsgPtr->CCSDS.StreamId[1] = (uint8)MsgId.Value;
+    MsgPtr->CCSDS.Sequence[0] = 0xC0; /* unsegmented */
+    MsgPtr->CCSDS.Length[0]   = (uint8)((Size - 7) >> 8);
+    MsgPtr->CCSDS.Length[1]   = (uint8)(Size - 7);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_SetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime)
+{
+    uint8 *Time = ((CFE_MSG_TelemetryHeader_t *)MsgPtr)->Sec.Time;
+
+    Time[0] = (uint8)(NewTime.Seconds >> 24);
+    Time[1] = (uint8)(NewTime.Seconds >> 16);
+    Time[2] = (uint8)(NewTime.Seconds >> 8);
+    Time[3] = (uint8)NewTime.Seconds;
+    Time[4] = (uint8)(NewTime.Subseconds >> 24);
+    Time[5] = (uint8)(NewTime.Subseconds >> 16);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
+{
+    MsgId->Value = ((MsgPtr->CCSDS.StreamId[0] << 8) | MsgPtr->CCSDS.StreamId[1]) & BENCH_MSG_MSGID_MASK;
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
+{
+    *Size = ((MsgPtr->CCSDS.Length[0] << 8) | MsgPtr->CCSDS.Length[1]) + 7;
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetMsgTime(const CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t *Time)
+{
+    const uint8 *Raw = ((const CFE_MSG_TelemetryHeader_t *)MsgPtr)->Sec.Time;
+
+    Time->Seconds    = ((uint32)Raw[0] << 24) | ((uint32)Raw[1] << 16) | ((uint32)Raw[2] << 8) | Raw[3];
+    Time->Subseconds = ((uint32)Raw[4] << 24) | ((uint32)Raw[5] << 16);
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t *SeqCnt)
+{
+    *SeqCnt = ((MsgPtr->CCSDS.Sequence[0] << 8) | MsgPtr->CCSDS.Sequence[1]) & 0x3FFF;
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    (void)EventID;
+    (void)EventType;
+    (void)Spec;
+
+    ++BENCH_EventCount;
+    return CFE_SUCCESS;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
+{
+    CFE_TIME_SysTime_t Time;
+    struct timespec    Now;
+
+    clock_gettime(CLOCK_REALTIME, &Now);
+    Time.Seconds    = (uint32)Now.tv_sec;
+    Time.Subseconds = (uint32)(((uint64)Now.tv_nsec << 32) / 1000000000);
+
+    return Time;
+}
+
+void CFE_PSP_GetTime(OS_time_t *LocalTime)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    LocalTime->ticks = ((int64)Now.tv_sec * 10000000) + (Now.tv_nsec / 100);
+}
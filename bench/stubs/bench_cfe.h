@@ -0,0 +1,549 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Minimal stand-ins for the OSAL, PSP and cFE APIs the TO_CON encoders use
+ *
+ *   Only what the encoder sources and the headers they include need is
+ *   declared here.  Message headers follow the CCSDS layout so that the
+ *   header accessors cost roughly what they do on a real target.  The build
+ *   generates cfe.h, osapi.h and friends as one-line wrappers around this
+ *   file.
+ */
+
+#ifndef BENCH_CFE_H
+#define BENCH_CFE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+/*
+ * common_types.h
+ */
+typedef int8_t    int8;
+typedef int16_t   int16;
+typedef int32_t   int32;
+typedef int64_t   int64;
+typedef uint8_t   uint8;
+typedef uint16_t  uint16;
+typedef uint32_t  uint32;
+typedef uint64_t  uint64;
+typedef uintptr_t cpuaddr;
+
+/*
+ * osapi.h
+ */
+typedef struct
+{
+    unsigned long Value;
+} osal_id_t;
+
+typedef struct
+{
+    int64 ticks; /* 100 ns */
+} OS_time_t;
+
+typedef struct
+{
+    size_t ActualLength;
+    char   AddrData[28];
+} OS_SockAddr_t;
+
+#define OS_OBJECT_ID_UNDEFINED ((osal_id_t) {0})
+#define OS_SUCCESS             0
+#define OS_ERROR               (-1)
+#define OS_SEM_TIMEOUT         (-6)
+#define OS_QUEUE_MAX_DEPTH     50
+#define OS_MAX_API_NAME        20
+
+static inline bool OS_ObjectIdDefined(osal_id_t Id)
+{
+    return Id.Value != 0;
+}
+
+static inline int64 OS_TimeGetTotalMilliseconds(OS_time_t Time)
+{
+    return Time.ticks / 10000;
+}
+
+int32 OS_MutSemCreate(osal_id_t *Id, const char *Name, uint32 Options);
+int32 OS_MutSemTake(osal_id_t Id);
+int32 OS_MutSemGive(osal_id_t Id);
+void  OS_printf(const char *Format, ...);
+
+/*
+ * cfe_error.h
+ */
+typedef int32 CFE_Status_t;
+
+#define CFE_SUCCESS                       ((CFE_Status_t)0)
+#define CFE_STATUS_EXTERNAL_RESOURCE_FAIL ((CFE_Status_t)0xc8000005)
+#define CFE_STATUS_RANGE_ERROR            ((CFE_Status_t)0xc8000006)
+#define CFE_STATUS_INCORRECT_STATE        ((CFE_Status_t)0xc8000007)
+#define CFE_STATUS_WRONG_MSG_LENGTH       ((CFE_Status_t)0xc8000002)
+#define CFE_SB_BAD_ARGUMENT               ((CFE_Status_t)0xca000003)
+
+/*
+ * cfe_sb / cfe_msg types
+ */
+typedef uint32 CFE_SB_MsgId_Atom_t;
+typedef struct
+{
+    CFE_SB_MsgId_Atom_t Value;
+} CFE_SB_MsgId_t;
+
+typedef struct
+{
+    uint8 Priority;
+    uint8 Reliability;
+} CFE_SB_Qos_t;
+
+typedef struct
+{
+    uint32 Value;
+} CFE_SB_PipeId_t;
+
+#define CFE_SB_MSGID_WRAP_VALUE(val)        {(val)}
+#define CFE_SB_INVALID_MSG_ID               ((CFE_SB_MsgId_t)CFE_SB_MSGID_WRAP_VALUE(0))
+#define CFE_PLATFORM_SB_HIGHEST_VALID_MSGID 0x1FFF
+#define CFE_SB_POLL                         0
+#define CFE_SB_PEND_FOREVER                 (-1)
+
+typedef size_t CFE_MSG_Size_t;
+typedef uint8  CFE_MSG_FcnCode_t;
+typedef uint16 CFE_MSG_SequenceCount_t;
+
+typedef struct
+{
+    uint32 Seconds;
+    uint32 Subseconds;
+} CFE_TIME_SysTime_t;
+
+typedef struct
+{
+    uint8 StreamId[2];
+    uint8 Sequence[2];
+    uint8 Length[2];
+} CCSDS_PrimaryHeader_t;
+
+typedef union
+{
+    CCSDS_PrimaryHeader_t CCSDS;
+    uint8                 Byte[sizeof(CCSDS_PrimaryHeader_t)];
+} CFE_MSG_Message_t;
+
+typedef struct
+{
+    uint8 FunctionCode;
+    uint8 Checksum;
+} CFE_MSG_CommandSecondaryHeader_t;
+
+typedef struct
+{
+    uint8 Time[6];
+} CFE_MSG_TelemetrySecondaryHeader_t;
+
+typedef struct
+{
+    CFE_MSG_Message_t                Msg;
+    CFE_MSG_CommandSecondaryHeader_t Sec;
+} CFE_MSG_CommandHeader_t;
+
+typedef struct
+{
+    CFE_MSG_Message_t                  Msg;
+    CFE_MSG_TelemetrySecondaryHeader_t Sec;
+    uint8                              Spare[4];
+} CFE_MSG_TelemetryHeader_t;
+
+typedef union
+{
+    CFE_MSG_Message_t Msg;
+    long long int     LongInt;
+    long double       LongDouble;
+} CFE_SB_Buffer_t;
+
+#define CFE_MSG_PTR(shdr) (&((shdr).Msg))
+
+static inline CFE_SB_MsgId_Atom_t CFE_SB_MsgIdToValue(CFE_SB_MsgId_t MsgId)
+{
+    return MsgId.Value;
+}
+
+static inline CFE_SB_MsgId_t CFE_SB_ValueToMsgId(CFE_SB_MsgId_Atom_t MsgIdValue)
+{
+    CFE_SB_MsgId_t MsgId = {MsgIdValue};
+    return MsgId;
+}
+
+static inline bool CFE_SB_MsgId_Equal(CFE_SB_MsgId_t MsgId1, CFE_SB_MsgId_t MsgId2)
+{
+    return MsgId1.Value == MsgId2.Value;
+}
+
+bool         CFE_SB_IsValidMsgId(CFE_SB_MsgId_t MsgId);
+int32        CFE_SB_MessageStringGet(char *DestStringPtr, const char *SourceStringPtr, const char *DefaultString,
+                                     size_t DestMaxSize, size_t SourceMaxSize);
+CFE_Status_t CFE_MSG_Init(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size);
+CFE_Status_t CFE_MSG_SetMsgTime(CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t NewTime);
+CFE_Status_t CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId);
+CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size);
+CFE_Status_t CFE_MSG_GetMsgTime(const CFE_MSG_Message_t *MsgPtr, CFE_TIME_SysTime_t *Time);
+CFE_Status_t CFE_MSG_GetSequenceCount(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_SequenceCount_t *SeqCnt);
+
+/*
+ * cfe_es / cfe_evs / cfe_tbl / cfe_psp
+ */
+typedef struct
+{
+    uint32 Value;
+} CFE_ES_TaskId_t;
+
+typedef void (*CFE_ES_ChildTaskMainFuncPtr_t)(void);
+
+typedef int16 CFE_TBL_Handle_t;
+
+enum
+{
+    CFE_EVS_EventType_DEBUG       = 1,
+    CFE_EVS_EventType_INFORMATION = 2,
+    CFE_EVS_EventType_ERROR       = 3,
+    CFE_EVS_EventType_CRITICAL    = 4
+};
+
+#define CFE_ES_PerfLogEntry(id) ((void)(id))
+#define CFE_ES_PerfLogExit(id)  ((void)(id))
+
+CFE_Status_t       CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...);
+CFE_TIME_SysTime_t CFE_TIME_GetTime(void);
+void               CFE_PSP_GetTime(OS_time_t *LocalTime);
+
+/*
+ * cfe_msgids.h, values as in the default cFE mission configuration
+ */
+#define CFE_ES_HK_TLM_MID           0x0800
+#define CFE_EVS_HK_TLM_MID          0x0801
+#define CFE_SB_HK_TLM_MID           0x0803
+#define CFE_TBL_HK_TLM_MID          0x0804
+#define CFE_TIME_HK_TLM_MID         0x0805
+#define CFE_TIME_DIAG_TLM_MID       0x0806
+#define CFE_EVS_LONG_EVENT_MSG_MID  0x0808
+#define CFE_EVS_SHORT_EVENT_MSG_MID 0x0809
+#define CFE_SB_STATS_TLM_MID        0x080A
+#define CFE_ES_APP_TLM_MID          0x080B
+#define CFE_TBL_REG_TLM_MID         0x080C
+#define CFE_ES_MEMSTATS_TLM_MID     0x0810
+
+#define CFE_PLATFORM_CMD_TOPICID_TO_MIDV(topic) (0x1800 | (topic))
+#define CFE_PLATFORM_TLM_TOPICID_TO_MIDV(topic) (0x0800 | (topic))
+
+/*
+ * cFE core housekeeping packets, without their trailing arrays
+ */
+#define CFE_MISSION_TBL_MAX_FULL_NAME_LEN 40
+#define CFE_MISSION_MAX_PATH_LEN          64
+#define CFE_PLATFORM_ES_POOL_MAX_BUCKETS  17
+
+typedef uint32 CFE_ES_MemOffset_t;
+typedef uint32 CFE_ES_MemHandle_t;
+
+typedef struct
+{
+    uint8              CommandCounter;
+    uint8              CommandErrorCounter;
+    uint16             CFECoreChecksum;
+    uint8              CFEMajorVersion;
+    uint8              CFEMinorVersion;
+    uint8              CFERevision;
+    uint8              CFEMissionRevision;
+    uint8              OSALMajorVersion;
+    uint8              OSALMinorVersion;
+    uint8              OSALRevision;
+    uint8              OSALMissionRevision;
+    uint8              PSPMajorVersion;
+    uint8              PSPMinorVersion;
+    uint8              PSPRevision;
+    uint8              PSPMissionRevision;
+    CFE_ES_MemOffset_t SysLogBytesUsed;
+    CFE_ES_MemOffset_t SysLogSize;
+    uint32             SysLogEntries;
+    uint32             SysLogMode;
+    uint32             ERLogIndex;
+    uint32             ERLogEntries;
+    uint32             RegisteredCoreApps;
+    uint32             RegisteredExternalApps;
+    uint32             RegisteredTasks;
+    uint32             RegisteredLibs;
+    uint32             ResetType;
+    uint32             ResetSubtype;
+    uint32             ProcessorResets;
+    uint32             MaxProcessorResets;
+    uint32             BootSource;
+    uint32             PerfState;
+    uint32             PerfMode;
+    uint32             PerfTriggerCount;
+    uint32             PerfFilterMask[4];
+    uint32             PerfTriggerMask[4];
+    uint32             PerfDataStart;
+    uint32             PerfDataEnd;
+    uint32             PerfDataCount;
+    uint32             PerfDataToWrite;
+    CFE_ES_MemOffset_t HeapBytesFree;
+    CFE_ES_MemOffset_t HeapBlocksFree;
+    CFE_ES_MemOffset_t HeapMaxBlockSize;
+} CFE_ES_HousekeepingTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t        TelemetryHeader;
+    CFE_ES_HousekeepingTlm_Payload_t Payload;
+} CFE_ES_HousekeepingTlm_t;
+
+typedef struct
+{
+    uint8  CommandCounter;
+    uint8  CommandErrorCounter;
+    uint8  MessageFormatMode;
+    uint8  MessageTruncCounter;
+    uint8  UnregisteredAppCounter;
+    uint8  OutputPort;
+    uint8  LogFullFlag;
+    uint8  LogMode;
+    uint16 MessageSendCounter;
+    uint16 LogOverflowCounter;
+    uint8  LogEnabled;
+    uint8  Spare1;
+    uint8  Spare2;
+    uint8  Spare3;
+} CFE_EVS_HousekeepingTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t         TelemetryHeader;
+    CFE_EVS_HousekeepingTlm_Payload_t Payload;
+} CFE_EVS_HousekeepingTlm_t;
+
+/*
+ * cFE event packets
+ */
+#define CFE_MISSION_MAX_API_LEN            20
+#define CFE_MISSION_EVS_MAX_MESSAGE_LENGTH 122
+
+typedef struct
+{
+    char   AppName[CFE_MISSION_MAX_API_LEN];
+    uint16 EventID;
+    uint16 EventType;
+    uint32 SpacecraftID;
+    uint32 ProcessorID;
+} CFE_EVS_PacketID_t;
+
+typedef struct
+{
+    CFE_EVS_PacketID_t PacketID;
+    char               Message[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    uint8              Spare1;
+    uint8              Spare2;
+} CFE_EVS_LongEventTlm_Payload_t;
+
+typedef struct
+{
+    CFE_EVS_PacketID_t PacketID;
+} CFE_EVS_ShortEventTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t      TelemetryHeader;
+    CFE_EVS_LongEventTlm_Payload_t Payload;
+} CFE_EVS_LongEventTlm_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t       TelemetryHeader;
+    CFE_EVS_ShortEventTlm_Payload_t Payload;
+} CFE_EVS_ShortEventTlm_t;
+
+typedef struct
+{
+    uint8              CommandCounter;
+    uint8              CommandErrorCounter;
+    uint8              NoSubscribersCounter;
+    uint8              MsgSendErrorCounter;
+    uint8              MsgReceiveErrorCounter;
+    uint8              InternalErrorCounter;
+    uint8              CreatePipeErrorCounter;
+    uint8              SubscribeErrorCounter;
+    uint8              PipeOptsErrorCounter;
+    uint8              DuplicateSubscriptionsCounter;
+    uint8              GetPipeIdByNameErrorCounter;
+    uint8              Spare2Align[1];
+    uint16             PipeOverflowErrorCounter;
+    uint16             MsgLimitErrorCounter;
+    CFE_ES_MemHandle_t MemPoolHandle;
+    uint32             MemInUse;
+    uint32             UnmarkedMem;
+} CFE_SB_HousekeepingTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t        TelemetryHeader;
+    CFE_SB_HousekeepingTlm_Payload_t Payload;
+} CFE_SB_HousekeepingTlm_t;
+
+typedef struct
+{
+    uint8              CommandCounter;
+    uint8              CommandErrorCounter;
+    uint16             NumTables;
+    uint16             NumLoadPending;
+    uint16             ValidationCounter;
+    uint32             LastValCrc;
+    int32              LastValStatus;
+    bool               ActiveBuffer;
+    char               LastValTableName[CFE_MISSION_TBL_MAX_FULL_NAME_LEN];
+    uint8              SuccessValCounter;
+    uint8              FailedValCounter;
+    uint8              NumValRequests;
+    uint8              NumFreeSharedBufs;
+    uint8              ByteAlignPad1;
+    CFE_ES_MemHandle_t MemPoolHandle;
+    CFE_TIME_SysTime_t LastUpdateTime;
+    char               LastUpdatedTable[CFE_MISSION_TBL_MAX_FULL_NAME_LEN];
+    char               LastFileLoaded[CFE_MISSION_MAX_PATH_LEN];
+    char               LastFileDumped[CFE_MISSION_MAX_PATH_LEN];
+    char               LastTableLoaded[CFE_MISSION_TBL_MAX_FULL_NAME_LEN];
+} CFE_TBL_HousekeepingTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t         TelemetryHeader;
+    CFE_TBL_HousekeepingTlm_Payload_t Payload;
+} CFE_TBL_HousekeepingTlm_t;
+
+typedef struct
+{
+    uint8  CommandCounter;
+    uint8  CommandErrorCounter;
+    uint16 ClockStateFlags;
+    int16  ClockStateAPI;
+    int16  LeapSeconds;
+    uint32 SecondsMET;
+    uint32 SubsecsMET;
+    uint32 SecondsSTCF;
+    uint32 SubsecsSTCF;
+} CFE_TIME_HousekeepingTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t          TelemetryHeader;
+    CFE_TIME_HousekeepingTlm_Payload_t Payload;
+} CFE_TIME_HousekeepingTlm_t;
+
+typedef struct
+{
+    uint32 MsgIdsInUse;
+    uint32 PeakMsgIdsInUse;
+    uint32 MaxMsgIdsAllowed;
+    uint32 PipesInUse;
+    uint32 PeakPipesInUse;
+    uint32 MaxPipesAllowed;
+    uint32 MemInUse;
+    uint32 PeakMemInUse;
+    uint32 MaxMemAllowed;
+    uint32 SubscriptionsInUse;
+    uint32 PeakSubscriptionsInUse;
+    uint32 MaxSubscriptionsAllowed;
+    uint32 SBBuffersInUse;
+    uint32 PeakSBBuffersInUse;
+    uint32 MaxPipeDepthAllowed;
+} CFE_SB_StatsTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    CFE_SB_StatsTlm_Payload_t Payload;
+} CFE_SB_StatsTlm_t;
+
+typedef struct
+{
+    CFE_ES_MemOffset_t BlockSize;
+    uint32             NumCreated;
+    uint32             NumFree;
+} CFE_ES_BlockStats_t;
+
+typedef struct
+{
+    CFE_ES_MemOffset_t  PoolSize;
+    uint32              NumBlocksRequested;
+    uint32              CheckErrCtr;
+    CFE_ES_MemOffset_t  NumFreeBytes;
+    CFE_ES_BlockStats_t BlockStats[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+} CFE_ES_MemPoolStats_t;
+
+typedef struct
+{
+    CFE_ES_MemHandle_t    PoolHandle;
+    CFE_ES_MemPoolStats_t PoolStats;
+} CFE_ES_PoolStatsTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader;
+    CFE_ES_PoolStatsTlm_Payload_t Payload;
+} CFE_ES_MemStatsTlm_t;
+
+/*
+ * MXM and HUFF result packets
+ */
+#define MXM_APP_HK_TLM_MID   0x08A3
+#define MXM_APP_RES_TLM_MID  0x08B3
+#define HUFF_APP_HK_TLM_MID  0x08A4
+#define HUFF_APP_RES_TLM_MID 0x08B4
+
+typedef struct
+{
+    char ResultStr[64];
+} MXM_APP_ResultTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t   TelemetryHeader;
+    MXM_APP_ResultTlm_Payload_t Payload;
+} MXM_APP_ResultTlm_t;
+
+typedef struct
+{
+    char ResultStr[64];
+} HUFF_APP_ResultTlm_Payload_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t    TelemetryHeader;
+    HUFF_APP_ResultTlm_Payload_t Payload;
+} HUFF_APP_ResultTlm_t;
+
+/*
+ * Bench bookkeeping
+ */
+extern uint32 BENCH_EventCount;
+
+#endif
@@ -0,0 +1,299 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  Host benchmark for the TO_CON output encoders
+ *
+ *  Feeds a fixed pool of synthetic software bus buffers through every
+ *  encoder in TO_CON_Encoders[] and reports messages/sec, ns/message and
+ *  output bytes/sec.  The pool follows a typical TO_CON MsgId mix: core
+ *  cFE housekeeping, event messages, MXM/HUFF result packets and a share
+ *  of MsgIds with no registered decoder.
+ *
+ *  Usage: to_con_bench [passes]
+ */
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "cfe.h"
+
+#include "to_con_app.h"
+#include "to_con_encode.h"
+#include "to_con_msgids.h"
+#include "to_con_registry.h"
+
+#define BENCH_POOL_SIZE      1024
+#define BENCH_MAX_MSG_BYTES  512
+#define BENCH_DEFAULT_PASSES 2000
+
+/*
+ * The registry and the encoders reach TO_CON state through the global
+ * object; the rest of the app is not linked in.
+ */
+TO_CON_GlobalData_t TO_CON_Global;
+
+/**
+ * One kind of message in the synthetic mix
+ */
+typedef struct
+{
+    const char *        Name;
+    CFE_SB_MsgId_Atom_t MsgIdValue;
+    size_t              Size;
+    const char *        ResultStr; /**< Result or event text for MXM/HUFF/EVS packets, NULL otherwise */
+    uint32              Weight;    /**< Share of the pool, out of the sum of all weights */
+} BENCH_MsgKind_t;
+
+typedef union
+{
+    CFE_SB_Buffer_t Buf;
+    uint8           Bytes[BENCH_MAX_MSG_BYTES];
+} BENCH_Msg_t;
+
+static const BENCH_MsgKind_t BENCH_MsgKinds[] = {
+    {"EVS_LONG_EVENT", CFE_EVS_LONG_EVENT_MSG_MID, sizeof(CFE_EVS_LongEventTlm_t),
+     "Cmd Counter = 12, Err Counter = 0, Last Cmd MID = 0x1806", 20},
+    {"ES_HK", CFE_ES_HK_TLM_MID, sizeof(CFE_ES_HousekeepingTlm_t), NULL, 5},
+    {"EVS_HK", CFE_EVS_HK_TLM_MID, sizeof(CFE_EVS_HousekeepingTlm_t), NULL, 5},
+    {"SB_HK", CFE_SB_HK_TLM_MID, sizeof(CFE_SB_HousekeepingTlm_t), NULL, 5},
+    {"TBL_HK", CFE_TBL_HK_TLM_MID, sizeof(CFE_TBL_HousekeepingTlm_t), NULL, 5},
+    {"TIME_HK", CFE_TIME_HK_TLM_MID, sizeof(CFE_TIME_HousekeepingTlm_t), NULL, 5},
+    {"SB_STATS", CFE_SB_STATS_TLM_MID, sizeof(CFE_SB_StatsTlm_t), NULL, 2},
+    {"ES_MEMSTATS", CFE_ES_MEMSTATS_TLM_MID, sizeof(CFE_ES_MemStatsTlm_t), NULL, 2},
+    {"TO_HK", TO_CON_HK_TLM_MID, sizeof(TO_CON_HkTlm_t), NULL, 5},
+    {"MXM_RES", MXM_APP_RES_TLM_MID, sizeof(MXM_APP_ResultTlm_t), "MXM 64x64 OK checksum=0x5A3C91F0 t=1834us", 20},
+    {"HUFF_RES", HUFF_APP_RES_TLM_MID, sizeof(HUFF_APP_ResultTlm_t), "HUFF 4096B -> 2291B OK t=2290us", 20},
+    {"unknown", 0x0899, 64, NULL, 6},
+};
+
+#define BENCH_NUM_KINDS (sizeof(BENCH_MsgKinds) / sizeof(BENCH_MsgKinds[0]))
+
+static BENCH_Msg_t BENCH_Pool[BENCH_POOL_SIZE];
+
+/*
+ * Fills one buffer the way the sending app would
+ */
+static void BENCH_InitMsg(BENCH_Msg_t *Msg, const BENCH_MsgKind_t *Kind, uint32 Serial)
+{
+    CFE_TIME_SysTime_t      Time;
+    CFE_EVS_LongEventTlm_t *Event;
+    size_t                  Size = Kind->Size;
+    size_t                  i;
+
+    if (Size > sizeof(Msg->Bytes))
+    {
+        Size = sizeof(Msg->Bytes);
+    }
+
+    CFE_MSG_Init(&Msg->Buf.Msg, CFE_SB_ValueToMsgId(Kind->MsgIdValue), Size);
+
+    Time.Seconds    = 1400000000 + (Serial / 10);
+    Time.Subseconds = (Serial % 10) * 0x19999999;
+    CFE_MSG_SetMsgTime(&Msg->Buf.Msg, Time);
+
+    for (i = sizeof(CFE_MSG_TelemetryHeader_t); i < Size; i++)
+    {
+        Msg->Bytes[i] = (uint8)(Serial + i);
+    }
+
+    if (Kind->MsgIdValue == CFE_EVS_LONG_EVENT_MSG_MID)
+    {
+        Event = (CFE_EVS_LongEventTlm_t *)&Msg->Buf;
+        memset(&Event->Payload, 0, sizeof(Event->Payload));
+        strncpy(Event->Payload.PacketID.AppName, "CFE_ES", sizeof(Event->Payload.PacketID.AppName) - 1);
+        Event->Payload.PacketID.EventID   = (uint16)(Serial % 50);
+        Event->Payload.PacketID.EventType = CFE_EVS_EventType_INFORMATION;
+        strncpy(Event->Payload.Message, Kind->ResultStr, sizeof(Event->Payload.Message) - 1);
+    }
+    else if (Kind->ResultStr != NULL)
+    {
+        /* Both result packets carry the string right after the header */
+        strncpy((char *)&Msg->Bytes[sizeof(CFE_MSG_TelemetryHeader_t)], Kind->ResultStr,
+                Size - sizeof(CFE_MSG_TelemetryHeader_t));
+    }
+}
+
+/*
+ * Builds the pool with each kind at its weight, in a fixed pseudo-random
+ * order so that consecutive messages do not share a MsgId
+ */
+static void BENCH_BuildPool(void)
+{
+    uint32 TotalWeight = 0;
+    uint32 Seed        = 12345;
+    uint32 Pick;
+    uint32 k;
+    uint32 i;
+
+    for (k = 0; k < BENCH_NUM_KINDS; k++)
+    {
+        TotalWeight += BENCH_MsgKinds[k].Weight;
+    }
+
+    for (i = 0; i < BENCH_POOL_SIZE; i++)
+    {
+        Seed = (Seed * 1103515245) + 12345;
+        Pick = (Seed >> 16) % TotalWeight;
+
+        for (k = 0; k < BENCH_NUM_KINDS - 1; k++)
+        {
+            if (Pick < BENCH_MsgKinds[k].Weight)
+            {
+                break;
+            }
+            Pick -= BENCH_MsgKinds[k].Weight;
+        }
+
+        BENCH_InitMsg(&BENCH_Pool[i], &BENCH_MsgKinds[k], i);
+    }
+}
+
+static uint64 BENCH_NowNanos(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return ((uint64)Now.tv_sec * 1000000000) + (uint64)Now.tv_nsec;
+}
+
+/*
+ * Runs one encoder over a set of messages and prints a result line
+ */
+static void BENCH_Run(const char *Label, const TO_CON_Encoder_t *Encoder, const TO_CON_Stream_t *Stream,
+                      const BENCH_Msg_t *Msgs, uint32 NumMsgs, uint32 Passes, bool Report)
+{
+    const void *  OutPtr;
+    size_t        OutSize;
+    uint64        Bytes  = 0;
+    uint64        Errors = 0;
+    uint64        Start;
+    uint64        Elapsed;
+    uint64        Count;
+    double        Seconds;
+    volatile char Sink = 0;
+    uint32        p;
+    uint32        i;
+
+    Start = BENCH_NowNanos();
+
+    for (p = 0; p < Passes; p++)
+    {
+        for (i = 0; i < NumMsgs; i++)
+        {
+            if (Encoder->EncodeFunc(&Msgs[i].Buf, Stream, 1400000000000LL + i, &OutPtr, &OutSize) != CFE_SUCCESS)
+            {
+                ++Errors;
+                continue;
+            }
+
+            /* Touch the output so the work cannot be optimized away */
+            Sink ^= ((const char *)OutPtr)[OutSize - 1];
+            Bytes += OutSize;
+        }
+    }
+
+    Elapsed = BENCH_NowNanos() - Start;
+    (void)Sink;
+
+    if (!Report)
+    {
+        return;
+    }
+
+    Count   = (uint64)Passes * NumMsgs;
+    Seconds = (double)Elapsed / 1e9;
+
+    printf("%-8s %-16s %10llu msgs %12.0f msgs/s %9.1f ns/msg %12.0f B/s %6.1f B/msg",
+           Encoder->Name, Label, (unsigned long long)Count, (double)Count / Seconds, (double)Elapsed / (double)Count,
+           (double)Bytes / Seconds, (double)Bytes / (double)Count);
+    if (Errors != 0)
+    {
+        printf(" %llu errors", (unsigned long long)Errors);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static BENCH_Msg_t KindMsgs[BENCH_POOL_SIZE];
+    TO_CON_Stream_t    DumpStream;
+    uint32             Passes = BENCH_DEFAULT_PASSES;
+    uint32             e;
+    uint32             k;
+    uint32             i;
+
+    if (argc > 1)
+    {
+        Passes = (uint32)strtoul(argv[1], NULL, 0);
+        if (Passes == 0)
+        {
+            fprintf(stderr, "usage: %s [passes]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (TO_CON_RegistryInit() != CFE_SUCCESS)
+    {
+        fprintf(stderr, "decoder registry init failed\n");
+        return 1;
+    }
+
+    BENCH_BuildPool();
+
+    /* Only count events raised by the encoders themselves */
+    BENCH_EventCount = 0;
+
+    printf("%u passes over a pool of %u messages\n\n", (unsigned int)Passes, (unsigned int)BENCH_POOL_SIZE);
+
+    for (e = 0; e < TO_CON_ENCODER_COUNT; e++)
+    {
+        /* Warm up caches and the branch predictor before timing */
+        BENCH_Run("warmup", &TO_CON_Encoders[e], NULL, BENCH_Pool, BENCH_POOL_SIZE, 1, false);
+        BENCH_Run("mix", &TO_CON_Encoders[e], NULL, BENCH_Pool, BENCH_POOL_SIZE, Passes, true);
+    }
+
+    printf("\n");
+
+    /* Per-kind breakdown, where decoders and name lookups differ */
+    for (k = 0; k < BENCH_NUM_KINDS; k++)
+    {
+        for (i = 0; i < BENCH_POOL_SIZE; i++)
+        {
+            BENCH_InitMsg(&KindMsgs[i], &BENCH_MsgKinds[k], i);
+        }
+
+        BENCH_Run(BENCH_MsgKinds[k].Name, &TO_CON_Encoders[TO_CON_ENCODER_TEXT], NULL, KindMsgs, BENCH_POOL_SIZE,
+                  (Passes / 4) + 1, true);
+    }
+
+    /* The last kind has no decoder, so it can also be dumped */
+    memset(&DumpStream, 0, sizeof(DumpStream));
+    DumpStream.InUse     = true;
+    DumpStream.DumpBytes = TO_CON_MAX_DUMP_BYTES;
+    BENCH_Run("unknown+hexdump", &TO_CON_Encoders[TO_CON_ENCODER_TEXT], &DumpStream, KindMsgs, BENCH_POOL_SIZE,
+              (Passes / 4) + 1, true);
+
+    if (BENCH_EventCount != 0)
+    {
+        printf("\n%u events were raised during the run\n", (unsigned int)BENCH_EventCount);
+    }
+
+    return 0;
+}
@@ -35,11 +35,14 @@
 /*
 ** TO_CON command codes
 */
-#define TO_CON_NOOP_CC            0 /*  no-op command     */
-#define TO_CON_RESET_STATUS_CC    1 /*  reset status      */
-#define TO_CON_ADD_PKT_CC         2 /*  add packet        */
-#define TO_CON_SEND_DATA_TYPES_CC 3 /*  send data types   */
-#define TO_CON_REMOVE_PKT_CC      4 /*  remove packet     */
-#define TO_CON_REMOVE_ALL_PKT_CC  5 /*  remove all packet */
+#define TO_CON_NOOP_CC             0 /*  no-op command     */
+#define TO_CON_RESET_STATUS_CC     1 /*  reset status      */
+#define TO_CON_ADD_PKT_CC          2 /*  add packet        */
+#define TO_CON_SEND_DATA_TYPES_CC  3 /*  send data types   */
+#define TO_CON_REMOVE_PKT_CC       4 /*  remove packet     */
+#define TO_CON_REMOVE_ALL_PKT_CC   5 /*  remove all packet */
+#define TO_CON_ENABLE_OUTPUT_CC    6 /*  enable udp output */
+#define TO_CON_SET_ENCODER_CC      7 /*  set encoder mode  */
+#define TO_CON_SET_EVENT_FILTER_CC 8 /*  set event filter  */
 
 #endif
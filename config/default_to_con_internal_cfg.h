@@ -40,14 +40,102 @@
 #define TO_CON_TASK_MSEC 100 /* run at 10 Hz */
 
 /**
- * @brief Telemetry pipe timeout
+ * @brief Telemetry wait mode: sleep TO_CON_TASK_MSEC, then poll the pipe
+ */
+#define TO_CON_TLM_WAIT_POLL 0
+
+/**
+ * @brief Telemetry wait mode: pend on the pipe and wake when data arrives
+ */
+#define TO_CON_TLM_WAIT_PEND 1
+
+/**
+ * @brief How the main task waits for telemetry
+ *
+ * In TO_CON_TLM_WAIT_PEND mode the main task blocks on the telemetry pipe
+ * for at most TO_CON_TLM_PEND_MSEC and starts forwarding as soon as the
+ * first packet arrives.  TO_CON_TLM_WAIT_POLL keeps the original fixed
+ * rate loop.
+ */
+#define TO_CON_TLM_WAIT_MODE TO_CON_TLM_WAIT_PEND
+
+/**
+ * @brief Longest time the main task pends on the telemetry pipe
+ *
+ * Only used in TO_CON_TLM_WAIT_PEND mode.  This also bounds how long
+ * commands and housekeeping requests wait when no telemetry is flowing.
+ */
+#define TO_CON_TLM_PEND_MSEC TO_CON_TASK_MSEC
+
+/**
+ * @brief Telemetry pipe timeout for the packets that follow the first one
  */
 #define TO_CON_TLM_PIPE_TIMEOUT CFE_SB_POLL
 
 /**
- * @brief Maximum number of telemetry packets to send each wakeup
+ * @brief Time budget of one telemetry drain pass, in microseconds
+ *
+ * A pass stops taking packets once its budget is spent, so commands are
+ * still serviced during bursts.  The running average cost of a packet
+ * is used to stop before the budget would be overrun.  While passes
+ * keep ending with telemetry left in the pipes the budget doubles, up
+ * to TO_CON_DRAIN_MAX_USEC, and it shrinks back once they are emptied.
+ */
+#define TO_CON_DRAIN_BUDGET_USEC 10000
+
+/**
+ * @brief Largest time budget of one telemetry drain pass, in microseconds
+ *
+ * Should stay well below TO_CON_TASK_MSEC so commands and housekeeping
+ * requests are serviced every cycle.
+ */
+#define TO_CON_DRAIN_MAX_USEC 50000
+
+/**
+ * @brief Most packets forwarded between two clock reads checking the drain budget
+ *
+ * Fewer are taken when the average packet cost says they would not fit.
  */
-#define TO_CON_MAX_TLM_PKTS OS_QUEUE_MAX_DEPTH
+#define TO_CON_DRAIN_CHECK_PKTS 8
+
+/**
+ * @brief Number of telemetry priority lanes
+ *
+ * Each lane has its own telemetry pipe.  A stream goes to the lane given
+ * by the Priority of its CFE_SB_Qos_t, which must be less than this; 0
+ * is the bulk lane.  Every drain pass empties the lanes from the most
+ * urgent down, so events never wait behind a housekeeping backlog.  In
+ * TO_CON_TLM_WAIT_PEND mode the task pends on the least urgent lane with
+ * a subscription and polls the others, see TO_CON_TLM_WAKE_SLICE_MSEC.
+ * The default subscription table puts events in lane 1; with 1 lane,
+ * which puts all telemetry in one pipe, its entry must be changed to
+ * priority 0.
+ */
+#define TO_CON_TLM_PRIORITY_LEVELS 2
+
+/**
+ * @brief Maximum number of packets taken from each lane above the bulk lane each wakeup
+ *
+ * Keeps a flood of urgent packets from starving the bulk lane.
+ */
+#define TO_CON_PRIORITY_LANE_BUDGET OS_QUEUE_MAX_DEPTH
+
+/**
+ * @brief Longest wait for a packet on a lane the task is not pending on, in milliseconds
+ *
+ * A task can only pend on one pipe.  When streams use more than one lane,
+ * TO_CON_TLM_WAIT_PEND mode pends on the least urgent lane, which carries
+ * most of the traffic, in slices of this length and polls the more urgent
+ * lanes between slices.
+ *
+ * By default there is one slice per pend, so the task wakes no more often
+ * than it would with one lane, and on an otherwise idle bus a packet on
+ * an urgent lane waits up to TO_CON_TLM_PEND_MSEC.  Shorter slices lower
+ * that latency at a cost of one wakeup and one SB poll per urgent lane
+ * every slice even when nothing is flowing: 10 ms is 100 wakeups a
+ * second with the default table, which uses two lanes.
+ */
+#define TO_CON_TLM_WAKE_SLICE_MSEC TO_CON_TLM_PEND_MSEC
 
 /**
  * Depth of pipe for commands to the TO_CON application itself
@@ -55,8 +143,292 @@
 #define TO_CON_CMD_PIPE_DEPTH 8
 
 /**
- * Depth of pipe for telemetry forwarded through the TO_CON application
+ * Depth of each priority lane's pipe for telemetry forwarded through the
+ * TO_CON application
  */
 #define TO_CON_TLM_PIPE_DEPTH OS_QUEUE_MAX_DEPTH
 
+/**
+ * @brief Timestamp source: the time in the packet's own secondary header
+ */
+#define TO_CON_TIMESTAMP_HEADER 0
+
+/**
+ * @brief Timestamp source: one PSP clock read per drain pass
+ */
+#define TO_CON_TIMESTAMP_CYCLE 1
+
+/**
+ * @brief Where the time printed with each packet comes from
+ *
+ * TO_CON_TIMESTAMP_HEADER prints when the packet was generated (mission
+ * time, via CFE_MSG_GetMsgTime).  TO_CON_TIMESTAMP_CYCLE reads the PSP
+ * clock once per drain pass and stamps the whole batch with it.  Neither
+ * reads a clock per packet.
+ */
+#define TO_CON_TIMESTAMP_SOURCE TO_CON_TIMESTAMP_HEADER
+
+/**
+ * @brief Encoder mode of the console and null sinks at startup
+ *
+ * One of the TO_CON_ENCODER_* values.  Each sink's mode can be changed at
+ * runtime with TO_CON_SET_ENCODER_CC.  TO_CON_ENCODER_BINARY needs
+ * TO_CON_CONSOLE_STDIO.
+ */
+#define TO_CON_DEFAULT_ENCODER_MODE TO_CON_ENCODER_TEXT
+
+/**
+ * @brief Write the console sink with stdio instead of OS_printf; host builds only
+ *
+ * By default the console sink goes through OS_printf, so it follows OSAL
+ * console redirection and OS_printf_disable() on every target.  OS_printf
+ * takes a C string of at most OS_BUFFER_SIZE - 1 characters, so each
+ * batch is written in chunks split on line boundaries, and binary frames
+ * cannot be sent to the console.  Set to 1 on targets with a hosted libc
+ * to write each batch with a single fwrite to stdout instead.  This
+ * bypasses the OSAL console, and it allows TO_CON_ENCODER_BINARY on the
+ * console.
+ */
+#define TO_CON_CONSOLE_STDIO 0
+
+/**
+ * @brief Encoder mode of the log file sink at startup
+ */
+#define TO_CON_FILE_ENCODER_MODE TO_CON_DEFAULT_ENCODER_MODE
+
+/**
+ * @brief Encoder mode of the UDP sink at startup
+ */
+#define TO_CON_UDP_ENCODER_MODE TO_CON_ENCODER_BINARY
+
+/**
+ * @brief Least severe event type that is output, at startup
+ *
+ * One of the CFE_EVS_EventType_* values.  Event packets below it are
+ * dropped before they are formatted.  Can be changed at runtime with
+ * TO_CON_SET_EVENT_FILTER_CC.
+ */
+#define TO_CON_EVENT_MIN_TYPE CFE_EVS_EventType_INFORMATION
+
+/**
+ * @brief Output sinks for streams with no SinkMask of their own
+ *
+ * Applies to streams added by command, table entries with a zero
+ * SinkMask and packets of no known stream.  A sink that is not enabled
+ * gets nothing whatever its bit.
+ */
+#define TO_CON_DEFAULT_SINK_MASK ((1 << TO_CON_SINK_COUNT) - 1)
+
+/**
+ * @brief Start the null sink, which discards its output
+ *
+ * Goes through the same encoding, queueing and writer task hand-off as
+ * a real sink, so it measures the cost of TO_CON itself.
+ */
+#define TO_CON_NULL_SINK_ENABLED 0
+
+/**
+ * @brief Maximum number of MsgIds with a registered name/decoder
+ *
+ * Covers the built-in cFE entries plus whatever mission apps register.
+ */
+#define TO_CON_MAX_DECODERS 64
+
+/**
+ * @brief Number of buckets in the decoder lookup hash
+ *
+ * Must be a power of two and should be at least twice TO_CON_MAX_DECODERS
+ * to keep probe sequences short.
+ */
+#define TO_CON_DECODER_HASH_SIZE 128
+
+/**
+ * @brief Longest decoder name, including the terminating NUL
+ */
+#define TO_CON_DECODER_NAME_LEN 20
+
+/**
+ * @brief Number of buckets in the MsgId to subscription slot hash
+ *
+ * Must be a power of two and larger than TO_CON_MAX_SUBSCRIPTIONS.
+ */
+#define TO_CON_STREAM_HASH_SIZE 64
+
+/**
+ * @brief Largest payload hex dump the text encoder prints
+ *
+ * Bounds the DumpBytes field of the subscription table.  Each dumped
+ * byte takes two characters of the output line.
+ */
+#define TO_CON_MAX_DUMP_BYTES 256
+
+/**
+ * @brief Payload hex dump length for streams added by command
+ *
+ * Streams from the subscription table use their own DumpBytes.
+ */
+#define TO_CON_DEFAULT_DUMP_BYTES 0
+
+/**
+ * @brief Emit on change keyframe period for streams added by command
+ *
+ * Zero outputs every packet.  Streams from the subscription table use
+ * their own KeyframeSec.
+ */
+#define TO_CON_DEFAULT_KEYFRAME_SEC 0
+
+/**
+ * @brief Upstream losses on one stream that raise an event
+ *
+ * Packets missing from a stream's CCSDS sequence count are totalled in
+ * telemetry.  An event is sent each time another this many have been lost
+ * on the same stream.
+ */
+#define TO_CON_SEQ_LOSS_EVENT_THRESHOLD 16
+
+/**
+ * @brief Number of output batches each sink's ring can hold
+ *
+ * Each output sink has a ring between the telemetry drain loop and its
+ * own writer task, so a slow sink only ever fills its own ring.  Lines
+ * that do not fit are dropped and counted per sink.  Must be a power of
+ * two.
+ */
+#define TO_CON_OUTPUT_RING_DEPTH 16
+
+/**
+ * @brief Size of one output batch buffer
+ *
+ * Encoded output is appended to a batch buffer which the writer task
+ * outputs with a single write.  Must be larger than the longest line;
+ * in binary mode larger frames are dropped.
+ */
+#define TO_CON_OUTPUT_BATCH_BYTES 4096
+
+/**
+ * @brief Batch fill level that hands a batch to the writer task
+ *
+ * A batch is also handed over when the next line does not fit and at the
+ * end of every drain pass, so this only matters during long bursts.
+ */
+#define TO_CON_OUTPUT_FLUSH_BYTES 3072
+
+/**
+ * @brief Most packets one output batch can hold
+ *
+ * Each packet in a batch carries its header time and stream for the
+ * latency histograms.  A full batch is handed to the writer task.
+ */
+#define TO_CON_OUTPUT_BATCH_PACKETS 128
+
+/**
+ * @brief Priority of the output sink writer child tasks
+ *
+ * Should be lower (numerically higher) than the TO_CON main task so that
+ * output I/O never delays draining the software bus.
+ */
+#define TO_CON_OUTPUT_TASK_PRIORITY 90
+
+/**
+ * @brief Stack size of each output sink writer child task
+ */
+#define TO_CON_OUTPUT_TASK_STACK_SIZE 8192
+
+/**
+ * @brief Largest UDP datagram payload the UDP output sends
+ *
+ * Whole lines or frames from an output batch are packed into each
+ * datagram up to this size; one that is larger is sent on its own.  The
+ * default fits an Ethernet frame without IP fragmentation.
+ */
+#define TO_CON_UDP_MTU 1472
+
+/**
+ * @brief Also write the output to a rotating log file
+ *
+ * The file sink has its own writer task, so file I/O never runs in the
+ * telemetry drain loop or holds up the other sinks.
+ */
+#define TO_CON_FILE_SINK_ENABLED 0
+
+/**
+ * @brief Path of the current log file
+ *
+ * Older files are kept as TO_CON_FILE_PATH.1, .2 and so on, .1 being the
+ * most recent.  The file left by a previous run is kept the same way.
+ */
+#define TO_CON_FILE_PATH "/cf/to_con.log"
+
+/**
+ * @brief Log files kept, the current one included
+ */
+#define TO_CON_FILE_MAX_FILES 4
+
+/**
+ * @brief Size at which the log file is rotated
+ *
+ * Batches are never split, so a file may be up to one batch smaller.
+ */
+#define TO_CON_FILE_MAX_BYTES (4 * 1024 * 1024)
+
+/**
+ * @brief Age at which the log file is rotated, in seconds
+ *
+ * Zero rotates by size only.  An empty file is never rotated.
+ */
+#define TO_CON_FILE_MAX_AGE_SEC 3600
+
+/**
+ * @brief Size of the log file write-behind buffer
+ *
+ * Batches collect here and are written to the file together.  Must be at
+ * least TO_CON_OUTPUT_BATCH_BYTES.
+ */
+#define TO_CON_FILE_BUFFER_BYTES (64 * 1024)
+
+/**
+ * @brief Longest time output may wait in the write-behind buffer, in milliseconds
+ */
+#define TO_CON_FILE_SYNC_MSEC 1000
+
+/**
+ * @brief Flight recorder content: every packet on the telemetry pipe, as received
+ */
+#define TO_CON_RECORDER_RAW 0
+
+/**
+ * @brief Flight recorder content: the encoded output, in the mode of the first sink it goes to
+ */
+#define TO_CON_RECORDER_ENCODED 1
+
+/**
+ * @brief Keep the most recent telemetry in a memory mapped circular file
+ *
+ * The recorder is appended to from the drain loop with a memcpy and an
+ * offset update, and survives a crash of the process.  Needs a POSIX
+ * host (mmap), so leave it off on other targets.
+ */
+#define TO_CON_RECORDER_ENABLED 0
+
+/**
+ * @brief What the flight recorder keeps, TO_CON_RECORDER_RAW or TO_CON_RECORDER_ENCODED
+ */
+#define TO_CON_RECORDER_CONTENT TO_CON_RECORDER_RAW
+
+/**
+ * @brief Path of the flight recorder file
+ *
+ * At startup the recording of the previous run is kept as
+ * TO_CON_RECORDER_PATH.prev.
+ */
+#define TO_CON_RECORDER_PATH "/cf/to_con.rec"
+
+/**
+ * @brief Size of the flight recorder file, header included
+ *
+ * The whole file is mapped and touched at startup, so this much memory
+ * stays resident.
+ */
+#define TO_CON_RECORDER_BYTES (4 * 1024 * 1024)
+
 #endif
@@ -28,15 +28,90 @@
 
 #include "common_types.h"
 #include "cfe_sb_extern_typedefs.h"
+#include "to_con_interface_cfg.h"
 #include "to_con_fcncodes.h"
 
+/**
+ * Encoder modes, see TO_CON_SET_ENCODER_CC
+ */
+#define TO_CON_ENCODER_TEXT   0 /**< \brief One line of text per packet */
+#define TO_CON_ENCODER_BINARY 1 /**< \brief CCSDS frames passed through unchanged */
+#define TO_CON_ENCODER_JSON   2 /**< \brief One JSON object per packet, one per line */
+#define TO_CON_ENCODER_COUNT  3
+
+/**
+ * Output sinks, see TO_CON_SET_ENCODER_CC and the SinkMask table field
+ */
+#define TO_CON_SINK_CONSOLE 0 /**< \brief Standard output */
+#define TO_CON_SINK_FILE    1 /**< \brief Rotating log file, if TO_CON_FILE_SINK_ENABLED */
+#define TO_CON_SINK_UDP     2 /**< \brief Datagrams, once enabled by TO_CON_ENABLE_OUTPUT_CC */
+#define TO_CON_SINK_NULL    3 /**< \brief Discards everything, if TO_CON_NULL_SINK_ENABLED; for measurements */
+#define TO_CON_SINK_COUNT   4
+
+/**
+ * Queue and throughput counters for one output sink
+ */
+typedef struct
+{
+    uint8  Enabled;         /**< \brief Packets are being queued for this sink */
+    uint8  EncoderMode;     /**< \brief TO_CON_ENCODER_* mode used for this sink */
+    uint16 QueueDepth;      /**< \brief Batches waiting for the sink's writer task */
+    uint16 QueueHighWater;  /**< \brief Highest queue depth seen, in batches */
+    uint16 spareToAlign[1];
+    uint32 PacketsQueued;   /**< \brief Packets queued for this sink */
+    uint32 BytesQueued;     /**< \brief Encoded bytes queued for this sink */
+    uint32 DropCount;       /**< \brief Packets dropped because the sink's queue was full */
+} TO_CON_SinkStats_t;
+
 typedef struct
 {
     uint8 CommandCounter;
     uint8 CommandErrorCounter;
-    uint8 spareToAlign[2];
+    uint8 EncoderMode;  /**< \brief TO_CON_ENCODER_* mode of the console sink */
+    uint8 EventMinType; /**< \brief Least severe CFE_EVS_EventType_* that is output */
+
+    uint32 PacketsSuppressed; /**< \brief Packets held back by per-stream output controls */
+    uint32 PacketsLost;       /**< \brief Packets missing from the CCSDS sequence of their stream */
+    uint32 LatencyP50Msec;    /**< \brief Median header-time-to-console latency */
+    uint32 LatencyP99Msec;    /**< \brief 99th percentile header-time-to-console latency */
+    uint32 LatencyMaxMsec;    /**< \brief Worst header-time-to-console latency */
+    uint32 DrainBudgetUsec;   /**< \brief Current time budget of a telemetry drain pass */
+    uint32 PacketCostNsec;    /**< \brief Average time to receive, encode and queue one packet */
+    uint32 DrainOverruns;     /**< \brief Drain passes that took longer than their budget */
+    uint32 DrainBacklogCount; /**< \brief Drain passes that ended on the budget with telemetry left queued */
+    uint32 CycleAvgUsec;      /**< \brief Average busy time of a main loop cycle since the last HK */
+    uint32 CycleMaxUsec;      /**< \brief Busy time of the worst main loop cycle */
+    uint32 CycleOverruns;     /**< \brief Cycles busy for longer than TO_CON_TASK_MSEC */
+    uint32 EventsFiltered;    /**< \brief Event packets below EventMinType, also counted as suppressed */
+
+    TO_CON_SinkStats_t Sinks[TO_CON_SINK_COUNT]; /**< \brief Indexed by TO_CON_SINK_* */
 } TO_CON_HkTlm_Payload_t;
 
+/**
+ * Throughput counters for one subscription slot
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t Stream;            /**< \brief Stream in this slot, invalid if the slot was never used */
+    uint32         PacketsReceived;   /**< \brief Packets taken off the telemetry pipe */
+    uint32         PacketsEmitted;    /**< \brief Packets queued for output */
+    uint32         PacketsSuppressed; /**< \brief Packets held back by output controls */
+    uint32         PacketsUnchanged;  /**< \brief Of those, packets with an unchanged payload */
+    uint32         PacketsLost;       /**< \brief Packets missing from the CCSDS sequence, dropped upstream */
+    uint32         EncodeErrors;      /**< \brief Packets the encoder rejected */
+    uint32         BytesWritten;      /**< \brief Encoded bytes queued for output */
+    uint32         LastSeenSeconds;   /**< \brief PSP time of the last packet, seconds part */
+    uint32         LastSeenMillis;    /**< \brief PSP time of the last packet, milliseconds part */
+    uint32         LatencyP50Msec;    /**< \brief Median header-time-to-console latency */
+    uint32         LatencyP99Msec;    /**< \brief 99th percentile header-time-to-console latency */
+    uint32         LatencyMaxMsec;    /**< \brief Worst header-time-to-console latency */
+} TO_CON_StreamStats_t;
+
+typedef struct
+{
+    TO_CON_StreamStats_t Streams[TO_CON_MAX_SUBSCRIPTIONS]; /**< \brief Indexed by subscription slot */
+} TO_CON_StreamStatsTlm_Payload_t;
+
 typedef struct
 {
     uint16 synch;
@@ -63,7 +138,20 @@ typedef struct
 
 typedef struct
 {
-    char dest_IP[16];
+    char dest_IP[16]; /**< \brief Dotted quad to send to on TO_CON_TLM_PORT; empty turns UDP output off */
 } TO_CON_EnableOutput_Payload_t;
 
+typedef struct
+{
+    uint8 EncoderMode; /**< \brief One of the TO_CON_ENCODER_* values */
+    uint8 Sink;        /**< \brief TO_CON_SINK_* to change; zero, the console, in older commands */
+    uint8 Spare[2];
+} TO_CON_SetEncoder_Payload_t;
+
+typedef struct
+{
+    uint8 MinEventType; /**< \brief Least severe CFE_EVS_EventType_* to output */
+    uint8 Spare[3];
+} TO_CON_SetEventFilter_Payload_t;
+
 #endif
@@ -29,5 +29,6 @@
 #define TO_CON_CMD_MID        CFE_PLATFORM_CMD_TOPICID_TO_MIDV(CFE_MISSION_TO_CON_CMD_TOPICID)
 #define TO_CON_SEND_HK_MID    CFE_PLATFORM_CMD_TOPICID_TO_MIDV(CFE_MISSION_TO_CON_SEND_HK_TOPICID)
 #define TO_CON_HK_TLM_MID     CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_TO_CON_HK_TLM_TOPICID)
+#define TO_CON_STREAM_STATS_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_TO_CON_STREAM_STATS_TLM_TOPICID)
 
 #endif
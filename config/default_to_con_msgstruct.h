@@ -54,6 +54,14 @@ typedef struct
 
 /******************************************************************************/
 
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t       TelemetryHeader; /**< \brief Telemetry header */
+    TO_CON_StreamStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} TO_CON_StreamStatsTlm_t;
+
+/******************************************************************************/
+
 /*
  * The following commands do not have any payload,
  * but should still "reserve" a unique structure type to
@@ -76,5 +84,44 @@ typedef struct
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
 } TO_CON_ResetCountersCmd_t;
 
+/******************************************************************************/
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} TO_CON_RemoveAllCmd_t;
+
+/******************************************************************************/
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t    CommandHeader; /**< \brief Command header */
+    TO_CON_AddPacket_Payload_t Payload;       /**< \brief Command payload */
+} TO_CON_AddPacketCmd_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t       CommandHeader; /**< \brief Command header */
+    TO_CON_RemovePacket_Payload_t Payload;       /**< \brief Command payload */
+} TO_CON_RemovePacketCmd_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t       CommandHeader; /**< \brief Command header */
+    TO_CON_EnableOutput_Payload_t Payload;       /**< \brief Command payload */
+} TO_CON_EnableOutputCmd_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t     CommandHeader; /**< \brief Command header */
+    TO_CON_SetEncoder_Payload_t Payload;       /**< \brief Command payload */
+} TO_CON_SetEncoderCmd_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t         CommandHeader; /**< \brief Command header */
+    TO_CON_SetEventFilter_Payload_t Payload;       /**< \brief Command payload */
+} TO_CON_SetEventFilterCmd_t;
+
 
 #endif /* TO_CON_MSGSTRUCT_H */
@@ -23,7 +23,21 @@
 #ifndef TO_CON_PERFIDS_H
 #define TO_CON_PERFIDS_H
 
-#define TO_CON_MAIN_TASK_PERF_ID   34
-#define TO_CON_SOCKET_SEND_PERF_ID 35
+#define TO_CON_MAIN_TASK_PERF_ID 34
+#define TO_CON_FORWARD_PERF_ID   35 /**< One telemetry packet, from receipt to queued output */
+
+/*
+ * Stages of forwarding a packet
+ */
+#define TO_CON_SB_RECEIVE_PERF_ID 36 /**< CFE_SB_ReceiveBuffer on a telemetry pipe */
+#define TO_CON_LOOKUP_PERF_ID     37 /**< MsgId to stream lookup, sequence tracking and output controls */
+#define TO_CON_ENCODE_PERF_ID     38 /**< Decoding and formatting, once per encoder mode in use */
+
+/*
+ * Output sink writes, one ID per writer task
+ */
+#define TO_CON_CONSOLE_WRITE_PERF_ID 39
+#define TO_CON_FILE_WRITE_PERF_ID    40
+#define TO_CON_UDP_WRITE_PERF_ID     41
 
 #endif
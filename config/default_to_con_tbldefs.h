@@ -41,8 +41,37 @@
 typedef struct
 {
     CFE_SB_MsgId_t Stream;
-    CFE_SB_Qos_t   Flags;
+    CFE_SB_Qos_t   Flags; /**< Priority selects the priority lane, see TO_CON_TLM_PRIORITY_LEVELS */
     uint16         BufLimit;
+
+    /*
+     * Output controls.  Packets held back by these are counted but never
+     * formatted.  Zero disables each control.
+     */
+    uint16 Decimation;      /**< Output 1 of every N packets */
+    uint16 MinIntervalMsec; /**< Minimum time between two outputs */
+    uint32 ByteBudget;      /**< Output bytes per second, token bucket with a one second burst */
+
+    /*
+     * Payload bytes printed in hex by the text encoder for packets with no
+     * decoder, at most TO_CON_MAX_DUMP_BYTES.  Zero prints no payload.
+     */
+    uint16 DumpBytes;
+
+    /*
+     * Emit on change: output a packet only when its payload differs from
+     * the last one output on this stream, and at least once every this
+     * many seconds.  The header's time and sequence count are ignored.
+     * Zero outputs every packet.
+     */
+    uint16 KeyframeSec;
+
+    /*
+     * Output sinks this stream goes to, bit (1 << TO_CON_SINK_*) for
+     * each.  Zero means TO_CON_DEFAULT_SINK_MASK.
+     */
+    uint8 SinkMask;
+    uint8 Spare;
 } TO_CON_Sub_t;
 
 #endif
@@ -26,6 +26,7 @@
 #define CFE_MISSION_TO_CON_CMD_TOPICID        0x80
 #define CFE_MISSION_TO_CON_SEND_HK_TOPICID    0x81
 #define CFE_MISSION_TO_CON_HK_TLM_TOPICID     0x80
+#define CFE_MISSION_TO_CON_STREAM_STATS_TLM_TOPICID 0x82
 //#define CFE_MISSION_TO_CON_DATA_TYPES_TOPICID 0x81
 
 #endif
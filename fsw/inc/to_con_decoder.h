@@ -0,0 +1,146 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   TO Console decoder registration interface
+ *
+ * Applications can register a name and an optional decoder for their own
+ * telemetry so that TO_CON prints something more useful than "unknown",
+ * without TO_CON having to be rebuilt.  A decoder is either a callback or
+ * a table of field descriptors rendered as key=value text.
+ */
+#ifndef TO_CON_DECODER_H
+#define TO_CON_DECODER_H
+
+#include <stddef.h>
+
+#include "common_types.h"
+#include "cfe_error.h"
+#include "cfe_sb_api_typedefs.h"
+
+/************************************************************************
+** Macro Definitions
+*************************************************************************/
+
+/**
+ * @brief Field descriptor for a member of a message's Payload
+ *
+ * Name, offset and size all come from the message struct, so a descriptor
+ * cannot disagree with the layout it describes.
+ *
+ * @param Struct  Message type, e.g. CFE_ES_HousekeepingTlm_t
+ * @param Member  Member of Struct.Payload, e.g. CommandCounter
+ * @param Type    One of the TO_CON_FIELD_* render types
+ */
+#define TO_CON_PAYLOAD_FIELD(Struct, Member, Type) \
+    {#Member, sizeof(#Member) - 1, (Type), sizeof(((Struct *)0)->Payload.Member), offsetof(Struct, Payload.Member)}
+
+/**
+ * @brief Field layout for a message type from an array of TO_CON_PAYLOAD_FIELD()
+ */
+#define TO_CON_FIELD_LAYOUT(Struct, FieldArray) \
+    {(FieldArray), sizeof(FieldArray) / sizeof((FieldArray)[0]), sizeof(Struct)}
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * @brief Decoder callback
+ *
+ * Renders the interesting parts of SourceBuffer as text into TextBuf.  The
+ * text must be NUL terminated and fit in TextBufSize bytes.  The message
+ * size has already been checked against the registered ExpectedSize.
+ */
+typedef CFE_Status_t (*TO_CON_DecodeFunc_t)(const CFE_SB_Buffer_t *SourceBuffer, char *TextBuf,
+                                            size_t TextBufSize);
+
+/**
+ * @brief How a described field is rendered
+ */
+typedef enum
+{
+    TO_CON_FIELD_UNSIGNED, /**< \brief Unsigned integer of 1, 2, 4 or 8 bytes, in decimal */
+    TO_CON_FIELD_SIGNED,   /**< \brief Signed integer of 1, 2, 4 or 8 bytes, in decimal */
+    TO_CON_FIELD_HEX,      /**< \brief Unsigned integer of 1, 2, 4 or 8 bytes, in hex; checksums, handles */
+    TO_CON_FIELD_STRING    /**< \brief Fixed size char array, up to the first NUL */
+} TO_CON_FieldType_t;
+
+/**
+ * @brief One field of a message, see TO_CON_PAYLOAD_FIELD()
+ */
+typedef struct
+{
+    const char *Name;
+    uint8       NameLen;
+    uint8       Type; /**< \brief TO_CON_FieldType_t */
+    uint16      Size;
+    uint16      Offset; /**< \brief From the start of the message */
+} TO_CON_FieldDesc_t;
+
+/**
+ * @brief Fields printed for a message type, see TO_CON_FIELD_LAYOUT()
+ */
+typedef struct
+{
+    const TO_CON_FieldDesc_t *Fields;
+    uint16                    NumFields;
+    size_t                    MinSize; /**< \brief Shorter messages are not decoded */
+} TO_CON_FieldLayout_t;
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+/**
+ * @brief Register a name and decoder for a telemetry MsgId
+ *
+ * Registering a MsgId that is already known replaces the previous entry.
+ *
+ * @param MsgId        Telemetry message ID
+ * @param Name         Short name printed for this packet; copied, may be truncated
+ * @param DecodeFunc   Decoder callback, or NULL to print the name only
+ * @param ExpectedSize Exact message size the decoder needs, or 0 for no check
+ *
+ * @retval #CFE_SUCCESS on success
+ * @retval #CFE_SB_BAD_ARGUMENT if MsgId or Name is invalid
+ * @retval #CFE_STATUS_INCORRECT_STATE if TO_CON is not initialized yet
+ * @retval #CFE_STATUS_RANGE_ERROR if the registry is full
+ */
+CFE_Status_t TO_CON_RegisterDecoder(CFE_SB_MsgId_t MsgId, const char *Name, TO_CON_DecodeFunc_t DecodeFunc,
+                                    size_t ExpectedSize);
+
+/**
+ * @brief Register a name and field layout for a telemetry MsgId
+ *
+ * The fields are printed as space separated key=value pairs.  Registering
+ * a MsgId that is already known replaces the previous entry.
+ *
+ * @param MsgId  Telemetry message ID
+ * @param Name   Short name printed for this packet; copied, may be truncated
+ * @param Layout Fields to print; not copied, must stay valid while TO_CON runs
+ *
+ * @retval #CFE_SUCCESS on success
+ * @retval #CFE_SB_BAD_ARGUMENT if MsgId, Name or Layout is invalid
+ * @retval #CFE_STATUS_INCORRECT_STATE if TO_CON is not initialized yet
+ * @retval #CFE_STATUS_RANGE_ERROR if the registry is full
+ */
+CFE_Status_t TO_CON_RegisterFieldDecoder(CFE_SB_MsgId_t MsgId, const char *Name, const TO_CON_FieldLayout_t *Layout);
+
+#endif
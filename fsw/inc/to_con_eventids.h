@@ -43,6 +43,22 @@
 #define TO_CON_NOOP_INF_EID          18
 #define TO_CON_TBL_ERR_EID           19
 #define TO_CON_ENCODE_ERR_EID        20
+#define TO_CON_OUTPUT_ERR_EID        21
+#define TO_CON_DECODER_INF_EID       22
+#define TO_CON_DECODER_ERR_EID       23
+#define TO_CON_ENCODER_INF_EID       24
+#define TO_CON_ENCODER_ERR_EID       25
+#define TO_CON_CMD_LEN_ERR_EID       26
+#define TO_CON_TBL_INF_EID           27
+#define TO_CON_SEQ_LOSS_ERR_EID      28
+#define TO_CON_FILE_ERR_EID          29
+#define TO_CON_FILE_INF_EID          30
+#define TO_CON_RECORDER_ERR_EID      31
+#define TO_CON_RECORDER_INF_EID      32
+#define TO_CON_UDP_ERR_EID           33
+#define TO_CON_UDP_INF_EID           34
+#define TO_CON_EVTFILTER_INF_EID     35
+#define TO_CON_EVTFILTER_ERR_EID     36
 
 /******************************************************************************/
 
@@ -23,6 +23,8 @@
 
 #include "cfe.h"
 #include "cfe_config.h"
+#include "cfe_msgids.h"
+#include "cfe_evs_msg.h"
 
 #include "to_con_app.h"
 #include "to_con_encode.h"
@@ -64,15 +66,22 @@ void TO_CON_AppMain(void)
     */
     while (CFE_ES_RunLoop(&RunStatus) == true)
     {
+#if (TO_CON_TLM_WAIT_MODE == TO_CON_TLM_WAIT_PEND)
+        /* Wakes on the first telemetry packet, or after the timeout so commands are still serviced */
+        TO_CON_forward_telemetry(TO_CON_TLM_PEND_MSEC);
+#else
         CFE_ES_PerfLogExit(TO_CON_MAIN_TASK_PERF_ID);
 
         OS_TaskDelay(TO_CON_TASK_MSEC);
 
         CFE_ES_PerfLogEntry(TO_CON_MAIN_TASK_PERF_ID);
 
-        TO_CON_forward_telemetry();
+        TO_CON_forward_telemetry(TO_CON_TLM_PIPE_TIMEOUT);
+#endif
 
         TO_CON_process_commands();
+
+        TO_CON_CycleEnd();
     }
 
     CFE_ES_ExitApp(RunStatus);
@@ -89,19 +98,17 @@ CFE_Status_t TO_CON_init(void)
     CFE_Status_t  status;
     char          PipeName[OS_MAX_API_NAME];
     uint16        PipeDepth;
-    uint16        i;
     char          ToTlmPipeName[OS_MAX_API_NAME];
     uint16        ToTlmPipeDepth;
     void *        TblPtr;
-    TO_CON_Sub_t *SubEntry;
     char          VersionString[TO_CON_CFG_MAX_VERSION_STR_LEN];
     osal_id_t     TimeBaseId = OS_OBJECT_ID_UNDEFINED;
     int32         OsStatus;
+    uint32        Lane;
 
     PipeDepth      = TO_CON_CMD_PIPE_DEPTH;
     strcpy(PipeName, "TO_CON_CMD_PIPE");
     ToTlmPipeDepth = TO_CON_TLM_PIPE_DEPTH;
-    strcpy(ToTlmPipeName, "TO_CON_TLM_PIPE");
 
     /*
     ** Register with EVS
@@ -122,14 +129,19 @@ CFE_Status_t TO_CON_init(void)
     }
     TO_CON_Global.TimeBaseId = TimeBaseId;
 
+    TO_CON_Global.Drain.BudgetUsec = TO_CON_DRAIN_BUDGET_USEC;
+    TO_CON_Global.EventMinType     = TO_CON_EVENT_MIN_TYPE;
+
     /*
     ** Initialize housekeeping packet (clear user data area)...
     */
     CFE_MSG_Init(CFE_MSG_PTR(TO_CON_Global.HkTlm.TelemetryHeader), CFE_SB_ValueToMsgId(TO_CON_HK_TLM_MID),
                  sizeof(TO_CON_Global.HkTlm));
+    CFE_MSG_Init(CFE_MSG_PTR(TO_CON_Global.StreamStatsTlm.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(TO_CON_STREAM_STATS_TLM_MID), sizeof(TO_CON_Global.StreamStatsTlm));
 
-    status =
-        CFE_TBL_Register(&TO_CON_Global.SubsTblHandle, "TO_CON_Subs", sizeof(TO_CON_Subs_t), CFE_TBL_OPT_DEFAULT, NULL);
+    status = CFE_TBL_Register(&TO_CON_Global.SubsTblHandle, "TO_CON_Subs", sizeof(TO_CON_Subs_t), CFE_TBL_OPT_DEFAULT,
+                              TO_CON_ValidateSubsTbl);
 
     if (status != CFE_SUCCESS)
     {
@@ -159,45 +171,74 @@ CFE_Status_t TO_CON_init(void)
 
     TO_CON_Global.SubsTblPtr = TblPtr; /* Save returned address */
 
+    status = TO_CON_RegistryInit();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
     /* Subscribe to my commands */
     status = CFE_SB_CreatePipe(&TO_CON_Global.Cmd_pipe, PipeDepth, PipeName);
-    if (status == CFE_SUCCESS)
+    if (status != CFE_SUCCESS)
     {
-        CFE_SB_Subscribe(CFE_SB_ValueToMsgId(TO_CON_SEND_HK_MID), TO_CON_Global.Cmd_pipe);
-    }
-    else
         CFE_EVS_SendEvent(TO_CON_CR_PIPE_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Can't create cmd pipe status %i",
                           __LINE__, (int)status);
+        return status;
+    }
 
-    /* Create TO TLM pipe */
-    status = CFE_SB_CreatePipe(&TO_CON_Global.Tlm_pipe, ToTlmPipeDepth, ToTlmPipeName);
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(TO_CON_SEND_HK_MID), TO_CON_Global.Cmd_pipe);
     if (status != CFE_SUCCESS)
     {
-        CFE_EVS_SendEvent(TO_CON_TLMPIPE_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Can't create Tlm pipe status %i",
-                          __LINE__, (int)status);
+        CFE_EVS_SendEvent(TO_CON_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't subscribe to send HK MID 0x%x status %i", __LINE__,
+                          (unsigned int)TO_CON_SEND_HK_MID, (int)status);
+        return status;
     }
 
-    /* Subscriptions for TLM pipe*/
-    SubEntry = TO_CON_Global.SubsTblPtr->Subs;
-    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(TO_CON_CMD_MID), TO_CON_Global.Cmd_pipe);
+    if (status != CFE_SUCCESS)
     {
-        if (!CFE_SB_IsValidMsgId(SubEntry->Stream))
+        CFE_EVS_SendEvent(TO_CON_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't subscribe to command MID 0x%x status %i", __LINE__,
+                          (unsigned int)TO_CON_CMD_MID, (int)status);
+        return status;
+    }
+
+    /* Create one TO TLM pipe per priority lane; the bulk lane keeps the original name */
+    for (Lane = 0; Lane < TO_CON_TLM_PRIORITY_LEVELS; Lane++)
+    {
+        if (Lane == 0)
         {
-            /* Only process until invalid MsgId is found*/
-            break;
+            strcpy(ToTlmPipeName, "TO_CON_TLM_PIPE");
+        }
+        else
+        {
+            snprintf(ToTlmPipeName, sizeof(ToTlmPipeName), "TO_CON_TLM_PIPE%u", (unsigned int)Lane);
         }
 
-        status = CFE_SB_SubscribeEx(SubEntry->Stream, TO_CON_Global.Tlm_pipe, SubEntry->Flags, SubEntry->BufLimit);
+        status = CFE_SB_CreatePipe(&TO_CON_Global.Tlm_pipe[Lane], ToTlmPipeDepth, ToTlmPipeName);
         if (status != CFE_SUCCESS)
         {
-            CFE_EVS_SendEvent(TO_CON_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "L%d TO Can't subscribe to stream 0x%x status %i", __LINE__,
-                              (unsigned int)CFE_SB_MsgIdToValue(SubEntry->Stream), (int)status);
+            CFE_EVS_SendEvent(TO_CON_TLMPIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO Can't create Tlm pipe %u status %i", __LINE__, (unsigned int)Lane, (int)status);
         }
+    }
 
-        ++SubEntry;
+    /* Subscriptions for TLM pipe*/
+    TO_CON_StreamReconcile(TO_CON_Global.SubsTblPtr);
+
+    /* Let go of the table so updates can be applied by TO_CON_ManageSubsTbl() */
+    CFE_TBL_ReleaseAddress(TO_CON_Global.SubsTblHandle);
+    TO_CON_Global.SubsTblPtr = NULL;
+
+    status = TO_CON_OutputInit();
+    if (status != CFE_SUCCESS)
+    {
+        return status;
     }
 
+    TO_CON_RecorderInit();
+
     CFE_Config_GetVersionString(VersionString, TO_CON_CFG_MAX_VERSION_STR_LEN, "TO Console",
                           TO_CON_VERSION, TO_CON_BUILD_CODENAME, TO_CON_LAST_OFFICIAL);
 
@@ -207,6 +248,106 @@ CFE_Status_t TO_CON_init(void)
     return CFE_SUCCESS;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_ValidateSubsTbl() -- Subscription table validation       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_CON_ValidateSubsTbl(void *TblData)
+{
+    const TO_CON_Subs_t *SubsTbl = TblData;
+    const TO_CON_Sub_t * SubEntry;
+    uint16               i;
+    uint16               j;
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        SubEntry = &SubsTbl->Subs[i];
+        if (!CFE_SB_IsValidMsgId(SubEntry->Stream))
+        {
+            break;
+        }
+
+        if (SubEntry->BufLimit == 0)
+        {
+            CFE_EVS_SendEvent(TO_CON_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO table entry %u stream 0x%x has a zero BufLimit", __LINE__, (unsigned int)i,
+                              (unsigned int)CFE_SB_MsgIdToValue(SubEntry->Stream));
+            return CFE_STATUS_VALIDATION_FAILURE;
+        }
+
+        if (SubEntry->DumpBytes > TO_CON_MAX_DUMP_BYTES)
+        {
+            CFE_EVS_SendEvent(TO_CON_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO table entry %u stream 0x%x dumps %u bytes, max %u", __LINE__, (unsigned int)i,
+                              (unsigned int)CFE_SB_MsgIdToValue(SubEntry->Stream), (unsigned int)SubEntry->DumpBytes,
+                              (unsigned int)TO_CON_MAX_DUMP_BYTES);
+            return CFE_STATUS_VALIDATION_FAILURE;
+        }
+
+        if (SubEntry->Flags.Priority >= TO_CON_TLM_PRIORITY_LEVELS)
+        {
+            CFE_EVS_SendEvent(TO_CON_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO table entry %u stream 0x%x has priority %u, max %u", __LINE__,
+                              (unsigned int)i, (unsigned int)CFE_SB_MsgIdToValue(SubEntry->Stream),
+                              (unsigned int)SubEntry->Flags.Priority, (unsigned int)(TO_CON_TLM_PRIORITY_LEVELS - 1));
+            return CFE_STATUS_VALIDATION_FAILURE;
+        }
+
+        if ((SubEntry->SinkMask >> TO_CON_SINK_COUNT) != 0)
+        {
+            CFE_EVS_SendEvent(TO_CON_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO table entry %u stream 0x%x has unknown sinks in mask 0x%x", __LINE__,
+                              (unsigned int)i, (unsigned int)CFE_SB_MsgIdToValue(SubEntry->Stream),
+                              (unsigned int)SubEntry->SinkMask);
+            return CFE_STATUS_VALIDATION_FAILURE;
+        }
+
+        for (j = 0; j < i; j++)
+        {
+            if (CFE_SB_MsgId_Equal(SubsTbl->Subs[j].Stream, SubEntry->Stream))
+            {
+                CFE_EVS_SendEvent(TO_CON_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "L%d TO table entry %u duplicates stream 0x%x", __LINE__, (unsigned int)i,
+                                  (unsigned int)CFE_SB_MsgIdToValue(SubEntry->Stream));
+                return CFE_STATUS_VALIDATION_FAILURE;
+            }
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_ManageSubsTbl() -- Apply a new subscription table        */
+/*                                                                 */
+/* Called on the housekeeping cycle.  A validated table load is    */
+/* applied as a diff against the active subscriptions.             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_ManageSubsTbl(void)
+{
+    CFE_Status_t status;
+    void *       TblPtr;
+
+    CFE_TBL_Manage(TO_CON_Global.SubsTblHandle);
+
+    status = CFE_TBL_GetAddress(&TblPtr, TO_CON_Global.SubsTblHandle);
+    if (status == CFE_TBL_INFO_UPDATED)
+    {
+        TO_CON_StreamReconcile(TblPtr);
+    }
+    else if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(TO_CON_TBL_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Can't get table addr status %i",
+                          __LINE__, (int)status);
+        return;
+    }
+
+    CFE_TBL_ReleaseAddress(TO_CON_Global.SubsTblHandle);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* TO_CON_process_commands() -- Process command pipe message       */
@@ -233,43 +374,553 @@ void TO_CON_process_commands(void)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* TO_CON_forward_telemetry() -- Forward telemetry                 */
+/* TO_CON_HeaderTimeMillis() -- Generation time of a packet       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void TO_CON_forward_telemetry(void)
+static inline int64 TO_CON_HeaderTimeMillis(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_Status_t     CfeStatus;
-    CFE_SB_Buffer_t *SBBufPtr;
-    const char *     TextBufPtr;
-    size_t           TextBufSize;
-    uint32           PktCount = 0;
+    CFE_TIME_SysTime_t MsgTime;
+
+    memset(&MsgTime, 0, sizeof(MsgTime));
+    CFE_MSG_GetMsgTime(&SBBufPtr->Msg, &MsgTime);
 
-    do
+    return TO_CON_TimeToMillis(MsgTime);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_EventFiltered() -- Is this an event below the threshold  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool TO_CON_EventFiltered(CFE_SB_MsgId_t MsgId, const CFE_SB_Buffer_t *SBBufPtr)
+{
+    const CFE_EVS_ShortEventTlm_t *EventPtr = (const CFE_EVS_ShortEventTlm_t *)SBBufPtr;
+    CFE_MSG_Size_t                 MsgSize  = 0;
+
+    if (!CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID)) &&
+        !CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID)))
     {
-        CfeStatus = CFE_SB_ReceiveBuffer(&SBBufPtr, TO_CON_Global.Tlm_pipe, TO_CON_TLM_PIPE_TIMEOUT);
+        return false;
+    }
 
-        if (CfeStatus == CFE_SUCCESS)
+    /* Both formats start with the same PacketID */
+    CFE_MSG_GetSize(&SBBufPtr->Msg, &MsgSize);
+    if (MsgSize < sizeof(*EventPtr))
+    {
+        return false;
+    }
+
+    return EventPtr->Payload.PacketID.EventType < TO_CON_Global.EventMinType;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_AdmitPacket() -- Find a packet's stream and filter it    */
+/*                                                                 */
+/* Returns false if the output controls hold the packet back.      */
+/* *StreamOut is the packet's stream, or NULL if it has none.      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool TO_CON_AdmitPacket(const CFE_SB_Buffer_t *SBBufPtr, int64 CycleTimeMillis, TO_CON_Stream_t **StreamOut)
+{
+    CFE_SB_MsgId_t        MsgId = CFE_SB_INVALID_MSG_ID;
+    TO_CON_Stream_t *     Stream;
+    TO_CON_StreamStats_t *Stats;
+
+    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
+    Stream     = TO_CON_StreamLookup(MsgId);
+    *StreamOut = Stream;
+    Stats      = NULL;
+
+    if (Stream != NULL)
+    {
+        TO_CON_StreamTrackSequence(Stream, SBBufPtr);
+
+        Stats = TO_CON_StreamStats(Stream);
+        ++Stats->PacketsReceived;
+        Stats->LastSeenSeconds = (uint32)(CycleTimeMillis / 1000);
+        Stats->LastSeenMillis  = (uint32)(CycleTimeMillis % 1000);
+    }
+
+    /* Ahead of the rate limit, so filtered events do not use up its tokens */
+    if (TO_CON_EventFiltered(MsgId, SBBufPtr))
+    {
+        if (Stats != NULL)
+        {
+            ++Stats->PacketsSuppressed;
+        }
+        ++TO_CON_Global.HkTlm.Payload.PacketsSuppressed;
+        ++TO_CON_Global.HkTlm.Payload.EventsFiltered;
+        return false;
+    }
+
+    if (Stream == NULL)
+    {
+        return true;
+    }
+
+    /* Suppressed packets are counted but never formatted */
+    if (TO_CON_StreamUnchanged(Stream, SBBufPtr, CycleTimeMillis))
+    {
+        ++Stats->PacketsUnchanged;
+        ++Stats->PacketsSuppressed;
+        ++TO_CON_Global.HkTlm.Payload.PacketsSuppressed;
+        return false;
+    }
+
+    if (!TO_CON_StreamAdmit(Stream, CycleTimeMillis))
+    {
+        ++Stats->PacketsSuppressed;
+        ++TO_CON_Global.HkTlm.Payload.PacketsSuppressed;
+        return false;
+    }
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_ForwardPacket() -- Filter, encode and queue one packet   */
+/*                                                                 */
+/* The packet is encoded at most once per encoder mode, however    */
+/* many sinks it goes to.                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_ForwardPacket(const CFE_SB_Buffer_t *SBBufPtr, int64 CycleTimeMillis)
+{
+    CFE_Status_t          EncodeStatus;
+    TO_CON_Stream_t *     Stream;
+    TO_CON_StreamStats_t *Stats = NULL;
+    TO_CON_Sink_t *       Sink;
+    TO_CON_OutputTag_t    Tag;
+    int64                 TimeMillis;
+    const void *          OutBufPtr[TO_CON_ENCODER_COUNT];
+    size_t                OutBufSize[TO_CON_ENCODER_COUNT];
+    uint32                Tried   = 0; /* Bit per encoder mode already run */
+    uint32                Failed  = 0; /* Bit per encoder mode that failed */
+    uint32                Queued  = 0;
+    size_t                Bytes   = 0;
+    size_t                Largest = 0;
+    uint8                 SinkMask;
+    uint8                 Mode;
+    bool                  Admitted;
+    uint32                i;
+
+    /* The flight recorder keeps everything, whatever the output controls do */
+    TO_CON_RecorderRaw(SBBufPtr);
+
+    CFE_ES_PerfLogEntry(TO_CON_LOOKUP_PERF_ID);
+    Admitted = TO_CON_AdmitPacket(SBBufPtr, CycleTimeMillis, &Stream);
+    CFE_ES_PerfLogExit(TO_CON_LOOKUP_PERF_ID);
+
+    if (!Admitted)
+    {
+        return;
+    }
+
+    if (Stream != NULL)
+    {
+        Stats = TO_CON_StreamStats(Stream);
+    }
+
+    /* The header time is needed for latency tracking whichever time is printed */
+    Tag.SourceMillis = TO_CON_HeaderTimeMillis(SBBufPtr);
+    Tag.StreamSlot   = (Stream != NULL) ? (uint16)(Stream - TO_CON_Global.Streams) : TO_CON_LATENCY_NO_STREAM;
+
+#if (TO_CON_TIMESTAMP_SOURCE == TO_CON_TIMESTAMP_HEADER)
+    TimeMillis = Tag.SourceMillis;
+#else
+    TimeMillis = CycleTimeMillis;
+#endif
+
+    SinkMask = (Stream != NULL) ? Stream->SinkMask : TO_CON_DEFAULT_SINK_MASK;
+
+    for (i = 0; i < TO_CON_SINK_COUNT; i++)
+    {
+        Sink = &TO_CON_Global.Output.Sinks[i];
+        if (!Sink->Enabled || (SinkMask & (1U << i)) == 0)
         {
-            CFE_ES_PerfLogEntry(TO_CON_SOCKET_SEND_PERF_ID);
+            continue;
+        }
 
-            CfeStatus = TO_CON_StringfyOutputMessage(SBBufPtr, &TextBufPtr, &TextBufSize);
+        /* Each encoder has its own buffer, so earlier encodings stay valid */
+        Mode = Sink->EncoderMode;
+        if ((Tried & (1U << Mode)) == 0)
+        {
+            Tried |= (1U << Mode);
 
-            if (CfeStatus != CFE_SUCCESS)
+            CFE_ES_PerfLogEntry(TO_CON_ENCODE_PERF_ID);
+            EncodeStatus =
+                TO_CON_Encoders[Mode].EncodeFunc(SBBufPtr, Stream, TimeMillis, &OutBufPtr[Mode], &OutBufSize[Mode]);
+            CFE_ES_PerfLogExit(TO_CON_ENCODE_PERF_ID);
+            if (EncodeStatus != CFE_SUCCESS)
             {
                 CFE_EVS_SendEvent(TO_CON_ENCODE_ERR_EID, CFE_EVS_EventType_ERROR, "Error packing output: %d\n",
-                                    (int)CfeStatus);
+                                  (int)EncodeStatus);
+                if (Stats != NULL)
+                {
+                    ++Stats->EncodeErrors;
+                }
+                Failed |= (1U << Mode);
+            }
+            else if (Tried == (1U << Mode))
+            {
+                /* The recorder keeps the first encoding, normally the console's */
+                TO_CON_RecorderEncoded(OutBufPtr[Mode], OutBufSize[Mode]);
+            }
+        }
+
+        if ((Failed & (1U << Mode)) != 0)
+        {
+            continue;
+        }
+
+        /* Never blocks; the sink's writer task does the I/O.  In binary mode this is the only copy. */
+        if (TO_CON_OutputPut(Sink, OutBufPtr[Mode], OutBufSize[Mode], &Tag))
+        {
+            ++Queued;
+            Bytes += OutBufSize[Mode];
+            if (OutBufSize[Mode] > Largest)
+            {
+                Largest = OutBufSize[Mode];
+            }
+        }
+    }
+
+    if (Queued != 0 && Stats != NULL)
+    {
+        ++Stats->PacketsEmitted;
+        Stats->BytesWritten += Bytes;
+        TO_CON_StreamEmitted(Stream, Largest);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_DrainAllowance() -- Packets that fit in the time left    */
+/*                                                                 */
+/* Estimated from the average packet cost, at most                 */
+/* TO_CON_DRAIN_CHECK_PKTS so a cost spike is caught early.        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 TO_CON_DrainAllowance(const TO_CON_DrainPass_t *Pass)
+{
+    const TO_CON_Drain_t *Drain = &TO_CON_Global.Drain;
+    OS_time_t             Now;
+    int64                 LeftUsec;
+    int64                 Fit;
+
+    memset(&Now, 0, sizeof(Now));
+    CFE_PSP_GetTime(&Now);
+    LeftUsec = (int64)Drain->BudgetUsec - (OS_TimeGetTotalMicroseconds(Now) - Pass->StartUsec);
+
+    if (LeftUsec <= 0)
+    {
+        return 0;
+    }
+
+    if (Drain->CostNsec == 0)
+    {
+        return TO_CON_DRAIN_CHECK_PKTS;
+    }
+
+    Fit = (LeftUsec * 1000) / Drain->CostNsec;
+    return (Fit < TO_CON_DRAIN_CHECK_PKTS) ? (uint32)Fit : TO_CON_DRAIN_CHECK_PKTS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_DrainLane() -- Forward the packets of one priority lane  */
+/*                                                                 */
+/* SBBufPtr is a packet already taken from the lane's pipe, or     */
+/* NULL.  Stops when the pipe is empty, the lane's packet budget   */
+/* is used up or the pass is out of time.  Returns true only in    */
+/* the last case, and only if the lane still had a packet: a pipe  */
+/* cannot be peeked, so one more packet is taken and forwarded to  */
+/* find out.  A capped lane is not a backlog; the rest of it goes  */
+/* first on the next pass.                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool TO_CON_DrainLane(uint32 Lane, CFE_SB_Buffer_t *SBBufPtr, TO_CON_DrainPass_t *Pass)
+{
+    CFE_Status_t CfeStatus;
+    uint32       LaneCount = 0;
+    bool         OutOfTime = false;
+
+    while (true)
+    {
+        if (Pass->Allowance == 0)
+        {
+            Pass->Allowance = TO_CON_DrainAllowance(Pass);
+
+            /* Every pass forwards at least one packet, whatever the budget */
+            if (Pass->Allowance == 0 && Pass->PktCount == 0)
+            {
+                Pass->Allowance = 1;
+            }
+        }
+
+        /*
+         * A packet taken off the pipe is always forwarded, even when out
+         * of time; out of time, the packet just shows the lane is behind.
+         */
+        if (SBBufPtr == NULL)
+        {
+            OutOfTime = (Pass->Allowance == 0);
+
+            CFE_ES_PerfLogEntry(TO_CON_SB_RECEIVE_PERF_ID);
+            CfeStatus = CFE_SB_ReceiveBuffer(&SBBufPtr, TO_CON_Global.Tlm_pipe[Lane], TO_CON_TLM_PIPE_TIMEOUT);
+            CFE_ES_PerfLogExit(TO_CON_SB_RECEIVE_PERF_ID);
+
+            /* If CfeStatus != CFE_SUCCESS, then no packet was received from CFE_SB_ReceiveBuffer() */
+            if (CfeStatus != CFE_SUCCESS)
+            {
+                return false;
+            }
+        }
+
+        CFE_ES_PerfLogEntry(TO_CON_FORWARD_PERF_ID);
+
+        TO_CON_ForwardPacket(SBBufPtr, Pass->CycleTimeMillis);
+
+        CFE_ES_PerfLogExit(TO_CON_FORWARD_PERF_ID);
+
+        SBBufPtr = NULL;
+        ++LaneCount;
+        ++Pass->PktCount;
+        if (Pass->Allowance != 0)
+        {
+            --Pass->Allowance;
+        }
+
+        if (OutOfTime)
+        {
+            return true;
+        }
+
+        /* The bulk lane is only bounded by time */
+        if (Lane != 0 && LaneCount >= TO_CON_PRIORITY_LANE_BUDGET)
+        {
+            return false;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_DrainAdapt() -- Update the drain budget after a pass     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_DrainAdapt(const TO_CON_DrainPass_t *Pass, bool Backlog)
+{
+    TO_CON_Drain_t *Drain = &TO_CON_Global.Drain;
+    OS_time_t       Now;
+    int64           ElapsedUsec;
+    int64           CostNsec;
+
+    if (Pass->PktCount != 0)
+    {
+        memset(&Now, 0, sizeof(Now));
+        CFE_PSP_GetTime(&Now);
+        ElapsedUsec = OS_TimeGetTotalMicroseconds(Now) - Pass->StartUsec;
+
+        /* Running average over about 8 passes, so one slow packet does not halt the next pass */
+        CostNsec = (ElapsedUsec * 1000) / Pass->PktCount;
+        if (Drain->CostNsec == 0)
+        {
+            Drain->CostNsec = (uint32)CostNsec;
+        }
+        else
+        {
+            Drain->CostNsec = (uint32)((int64)Drain->CostNsec + (CostNsec - (int64)Drain->CostNsec) / 8);
+        }
+
+        if (ElapsedUsec > (int64)Drain->BudgetUsec)
+        {
+            ++TO_CON_Global.HkTlm.Payload.DrainOverruns;
+        }
+    }
+
+    if (Backlog)
+    {
+        ++TO_CON_Global.HkTlm.Payload.DrainBacklogCount;
+
+        Drain->BudgetUsec *= 2;
+        if (Drain->BudgetUsec > TO_CON_DRAIN_MAX_USEC)
+        {
+            Drain->BudgetUsec = TO_CON_DRAIN_MAX_USEC;
+        }
+    }
+    else if (Drain->BudgetUsec > TO_CON_DRAIN_BUDGET_USEC)
+    {
+        Drain->BudgetUsec /= 2;
+        if (Drain->BudgetUsec < TO_CON_DRAIN_BUDGET_USEC)
+        {
+            Drain->BudgetUsec = TO_CON_DRAIN_BUDGET_USEC;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_WaitTelemetry() -- Wait for a packet on any lane in use  */
+/*                                                                 */
+/* Pends on the least urgent lane in use.  If more urgent lanes    */
+/* are in use too, the wait is cut into TO_CON_TLM_WAKE_SLICE_MSEC */
+/* slices and those lanes are polled before each one.  Returns     */
+/* true with the packet and its lane, or false once WaitTimeout    */
+/* has passed with nothing received.                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool TO_CON_WaitTelemetry(int32 WaitTimeout, CFE_SB_Buffer_t **SBBufPtr, uint32 *LaneOut)
+{
+    const TO_CON_StreamIndex_t *Index     = &TO_CON_Global.StreamIndex;
+    int32                       Remaining = WaitTimeout;
+    int32                       Slice;
+    uint32                      Lane;
+    CFE_Status_t                CfeStatus;
+
+    while (true)
+    {
+        Slice = Remaining;
+
+        if (Index->TopLane != Index->WaitLane)
+        {
+            for (Lane = Index->TopLane; Lane > Index->WaitLane; Lane--)
+            {
+                CfeStatus = CFE_SB_ReceiveBuffer(SBBufPtr, TO_CON_Global.Tlm_pipe[Lane], CFE_SB_POLL);
+                if (CfeStatus == CFE_SUCCESS)
+                {
+                    *LaneOut = Lane;
+                    return true;
+                }
             }
-            else
+
+            if (Remaining == CFE_SB_PEND_FOREVER || Remaining > TO_CON_TLM_WAKE_SLICE_MSEC)
             {
-                OS_printf("%s\n", TextBufPtr);
+                Slice = TO_CON_TLM_WAKE_SLICE_MSEC;
             }
+        }
+
+        CfeStatus = CFE_SB_ReceiveBuffer(SBBufPtr, TO_CON_Global.Tlm_pipe[Index->WaitLane], Slice);
+        if (CfeStatus == CFE_SUCCESS)
+        {
+            *LaneOut = Index->WaitLane;
+            return true;
+        }
+
+        /* Only a timed out slice is worth another try */
+        if (CfeStatus != CFE_SB_TIME_OUT || Remaining == Slice)
+        {
+            return false;
+        }
+
+        if (Remaining != CFE_SB_PEND_FOREVER)
+        {
+            Remaining -= Slice;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_forward_telemetry() -- Forward telemetry                 */
+/*                                                                 */
+/* WaitTimeout only applies to the wait for the first packet, on   */
+/* any lane in use; then every lane is drained with                */
+/* TO_CON_TLM_PIPE_TIMEOUT, most urgent first, for as long as the  */
+/* pass's time budget allows.                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_forward_telemetry(int32 WaitTimeout)
+{
+    CFE_SB_Buffer_t *  SBBufPtr = NULL;
+    OS_time_t          LocalTime;
+    TO_CON_DrainPass_t Pass;
+    uint32             WokenLane = 0;
+    bool               Received;
+    bool               Backlog = false;
+    int32              Lane;
+
+    if (WaitTimeout != CFE_SB_POLL)
+    {
+        CFE_ES_PerfLogExit(TO_CON_MAIN_TASK_PERF_ID);
+    }
+
+    CFE_ES_PerfLogEntry(TO_CON_SB_RECEIVE_PERF_ID);
+    Received = TO_CON_WaitTelemetry(WaitTimeout, &SBBufPtr, &WokenLane);
+    CFE_ES_PerfLogExit(TO_CON_SB_RECEIVE_PERF_ID);
+
+    if (WaitTimeout != CFE_SB_POLL)
+    {
+        CFE_ES_PerfLogEntry(TO_CON_MAIN_TASK_PERF_ID);
+    }
 
-            CFE_ES_PerfLogExit(TO_CON_SOCKET_SEND_PERF_ID);
+    /*
+     * One clock read per pass, shared by rate limiting,
+     * TO_CON_TIMESTAMP_CYCLE, the drain budget and the cycle busy time.
+     * Read even if the wait timed out, as the other lanes may hold
+     * packets.
+     */
+    memset(&LocalTime, 0, sizeof(LocalTime));
+    CFE_PSP_GetTime(&LocalTime);
+    Pass.CycleTimeMillis = OS_TimeGetTotalMilliseconds(LocalTime);
+    Pass.StartUsec       = OS_TimeGetTotalMicroseconds(LocalTime);
+    Pass.PktCount        = 0;
+    Pass.Allowance       = 0;
+
+    TO_CON_Global.Cycle.StartUsec = Pass.StartUsec;
+
+    for (Lane = TO_CON_TLM_PRIORITY_LEVELS - 1; Lane >= 0; Lane--)
+    {
+        /* The packet that ended the wait is the first of its lane */
+        if (TO_CON_DrainLane((uint32)Lane,
+                             ((uint32)Lane == WokenLane && Received) ? SBBufPtr : NULL, &Pass))
+        {
+            Backlog = true;
         }
-        /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_ReceiveBuffer() */
+    }
+
+    TO_CON_OutputFlush();
+    TO_CON_RegistryQuiescent();
 
-        PktCount++;
-    } while (CfeStatus == CFE_SUCCESS && PktCount < TO_CON_MAX_TLM_PKTS);
+    TO_CON_DrainAdapt(&Pass, Backlog);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_CycleEnd() -- Account for the busy time of one cycle     */
+/*                                                                 */
+/* Called at the end of every main loop cycle; the cycle started   */
+/* when the telemetry wait ended.                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_CycleEnd(void)
+{
+    TO_CON_Cycle_t *Cycle = &TO_CON_Global.Cycle;
+    OS_time_t       Now;
+    int64           BusyUsec;
+
+    memset(&Now, 0, sizeof(Now));
+    CFE_PSP_GetTime(&Now);
+    BusyUsec = OS_TimeGetTotalMicroseconds(Now) - Cycle->StartUsec;
+    if (BusyUsec < 0)
+    {
+        BusyUsec = 0;
+    }
+
+    Cycle->BusyUsecSum += (uint64)BusyUsec;
+    ++Cycle->Cycles;
+
+    if (BusyUsec > Cycle->MaxUsec)
+    {
+        Cycle->MaxUsec = (uint32)BusyUsec;
+    }
+
+    if (BusyUsec > ((int64)TO_CON_TASK_MSEC * 1000))
+    {
+        ++TO_CON_Global.HkTlm.Payload.CycleOverruns;
+    }
 }
 
 /************************/
@@ -32,28 +32,83 @@
 #include "to_con_platform_cfg.h"
 #include "to_con_cmds.h"
 #include "to_con_dispatch.h"
+#include "to_con_file.h"
+#include "to_con_latency.h"
+#include "to_con_output.h"
+#include "to_con_recorder.h"
+#include "to_con_registry.h"
+#include "to_con_streams.h"
 #include "to_con_msg.h"
 #include "to_con_tbl.h"
+#include "to_con_udp.h"
 
 /************************************************************************
 ** Type Definitions
 *************************************************************************/
 
+/**
+ * Adaptive time budget of the telemetry drain loop
+ */
+typedef struct
+{
+    uint32 BudgetUsec; /**< Time budget of the next pass */
+    uint32 CostNsec;   /**< Running average cost of forwarding one packet */
+} TO_CON_Drain_t;
+
+/**
+ * State of one telemetry drain pass
+ */
+typedef struct
+{
+    int64  CycleTimeMillis;
+    int64  StartUsec;
+    uint32 PktCount;
+    uint32 Allowance; /**< Packets that may still be taken before the clock is checked again */
+} TO_CON_DrainPass_t;
+
+/**
+ * Busy time of the main loop, measured from the end of the telemetry wait
+ * to the end of command processing
+ */
+typedef struct
+{
+    int64  StartUsec;
+    uint64 BusyUsecSum; /**< Since the last HK */
+    uint32 Cycles;      /**< Since the last HK */
+    uint32 MaxUsec;
+} TO_CON_Cycle_t;
+
 /**
  * CI global data structure
  */
 typedef struct
 {
-    CFE_SB_PipeId_t Tlm_pipe;
+    CFE_SB_PipeId_t Tlm_pipe[TO_CON_TLM_PRIORITY_LEVELS]; /**< Indexed by priority lane */
     CFE_SB_PipeId_t Cmd_pipe;
 
-    TO_CON_HkTlm_t        HkTlm;
-    TO_CON_DataTypesTlm_t DataTypesTlm;
+    TO_CON_HkTlm_t          HkTlm;
+    TO_CON_DataTypesTlm_t   DataTypesTlm;
+    TO_CON_StreamStatsTlm_t StreamStatsTlm;
 
     TO_CON_Subs_t *  SubsTblPtr;
     CFE_TBL_Handle_t SubsTblHandle;
 
     osal_id_t        TimeBaseId;
+
+    TO_CON_Drain_t Drain;
+    TO_CON_Cycle_t Cycle;
+
+    uint8 EventMinType; /**< Least severe CFE_EVS_EventType_* that is output */
+
+    TO_CON_Stream_t      Streams[TO_CON_MAX_SUBSCRIPTIONS];
+    TO_CON_StreamIndex_t StreamIndex;
+
+    TO_CON_Output_t   Output;
+    TO_CON_File_t     File;
+    TO_CON_Recorder_t Recorder;
+    TO_CON_Udp_t      Udp;
+    TO_CON_Latency_t  Latency;
+    TO_CON_Registry_t Registry;
 } TO_CON_GlobalData_t;
 
 /************************************************************************
@@ -63,12 +118,23 @@ typedef struct
 void  TO_CON_AppMain(void);
 void  TO_CON_openTLM(void);
 int32 TO_CON_init(void);
+int32 TO_CON_ValidateSubsTbl(void *TblData);
+void  TO_CON_ManageSubsTbl(void);
 void  TO_CON_process_commands(void);
-void  TO_CON_forward_telemetry(void);
+void  TO_CON_forward_telemetry(int32 WaitTimeout);
+void  TO_CON_CycleEnd(void);
 
 /******************************************************************************/
 
 /* Global State Object */
 extern TO_CON_GlobalData_t TO_CON_Global;
 
+/**
+ * Throughput counters for a stream, kept in the stream statistics packet
+ */
+static inline TO_CON_StreamStats_t *TO_CON_StreamStats(const TO_CON_Stream_t *Entry)
+{
+    return &TO_CON_Global.StreamStatsTlm.Payload.Streams[Entry - TO_CON_Global.Streams];
+}
+
 #endif
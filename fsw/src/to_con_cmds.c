@@ -28,6 +28,7 @@
 #include "to_con_msg.h"
 #include "to_con_eventids.h"
 #include "to_con_msgids.h"
+#include "to_con_encode.h"
 
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -49,8 +50,40 @@ CFE_Status_t TO_CON_NoopCmd(const TO_CON_NoopCmd_t *data)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 CFE_Status_t TO_CON_ResetCountersCmd(const TO_CON_ResetCountersCmd_t *data)
 {
+    TO_CON_StreamStats_t *Stats;
+    TO_CON_Sink_t *       Sink;
+    CFE_SB_MsgId_t        Stream;
+    uint32                i;
+
     TO_CON_Global.HkTlm.Payload.CommandErrorCounter = 0;
     TO_CON_Global.HkTlm.Payload.CommandCounter      = 0;
+
+    TO_CON_Global.HkTlm.Payload.PacketsSuppressed = 0;
+    TO_CON_Global.HkTlm.Payload.PacketsLost       = 0;
+    TO_CON_Global.HkTlm.Payload.DrainOverruns     = 0;
+    TO_CON_Global.HkTlm.Payload.DrainBacklogCount = 0;
+    TO_CON_Global.HkTlm.Payload.CycleOverruns     = 0;
+    TO_CON_Global.HkTlm.Payload.EventsFiltered    = 0;
+    TO_CON_Global.Cycle.MaxUsec                   = 0;
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        Stats = &TO_CON_Global.StreamStatsTlm.Payload.Streams[i];
+        Stream = Stats->Stream;
+        memset(Stats, 0, sizeof(*Stats));
+        Stats->Stream = Stream;
+    }
+
+    for (i = 0; i < TO_CON_SINK_COUNT; i++)
+    {
+        Sink                = &TO_CON_Global.Output.Sinks[i];
+        Sink->HighWater     = 0;
+        Sink->DropCount     = 0;
+        Sink->PacketsQueued = 0;
+        Sink->BytesQueued   = 0;
+    }
+
+    TO_CON_LatencyResetAll();
     return CFE_SUCCESS;
 }
 
@@ -61,7 +94,245 @@ CFE_Status_t TO_CON_ResetCountersCmd(const TO_CON_ResetCountersCmd_t *data)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 CFE_Status_t TO_CON_SendHkCmd(const TO_CON_SendHkCmd_t *data)
 {
+    TO_CON_HkTlm_Payload_t *    Payload = &TO_CON_Global.HkTlm.Payload;
+    TO_CON_StreamStats_t *      Stats;
+    const TO_CON_LatencyHist_t *Hist;
+    const TO_CON_Sink_t *       Sink;
+    TO_CON_SinkStats_t *        SinkStats;
+    TO_CON_Cycle_t *            Cycle;
+    uint32                      i;
+
+    TO_CON_ManageSubsTbl();
+
+    Payload->EncoderMode     = TO_CON_Global.Output.Sinks[TO_CON_SINK_CONSOLE].EncoderMode;
+    Payload->EventMinType    = TO_CON_Global.EventMinType;
+    Payload->DrainBudgetUsec = TO_CON_Global.Drain.BudgetUsec;
+    Payload->PacketCostNsec  = TO_CON_Global.Drain.CostNsec;
+
+    /* The average covers the cycles since the last HK request */
+    Cycle                 = &TO_CON_Global.Cycle;
+    Payload->CycleAvgUsec = (Cycle->Cycles != 0) ? (uint32)(Cycle->BusyUsecSum / Cycle->Cycles) : 0;
+    Payload->CycleMaxUsec = Cycle->MaxUsec;
+    Cycle->BusyUsecSum    = 0;
+    Cycle->Cycles         = 0;
+
+    for (i = 0; i < TO_CON_SINK_COUNT; i++)
+    {
+        Sink                      = &TO_CON_Global.Output.Sinks[i];
+        SinkStats                 = &Payload->Sinks[i];
+        SinkStats->Enabled        = Sink->Enabled;
+        SinkStats->EncoderMode    = Sink->EncoderMode;
+        SinkStats->QueueDepth     = (uint16)TO_CON_OutputOccupancy(Sink);
+        SinkStats->QueueHighWater = (uint16)Sink->HighWater;
+        SinkStats->PacketsQueued  = Sink->PacketsQueued;
+        SinkStats->BytesQueued    = Sink->BytesQueued;
+        SinkStats->DropCount      = Sink->DropCount;
+    }
+
+    Hist                    = &TO_CON_Global.Latency.Overall;
+    Payload->LatencyP50Msec = TO_CON_LatencyPercentile(Hist, 50);
+    Payload->LatencyP99Msec = TO_CON_LatencyPercentile(Hist, 99);
+    Payload->LatencyMaxMsec = Hist->MaxMsec;
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        Stats                 = &TO_CON_Global.StreamStatsTlm.Payload.Streams[i];
+        Hist                  = &TO_CON_Global.Latency.Streams[i];
+        Stats->LatencyP50Msec = TO_CON_LatencyPercentile(Hist, 50);
+        Stats->LatencyP99Msec = TO_CON_LatencyPercentile(Hist, 99);
+        Stats->LatencyMaxMsec = Hist->MaxMsec;
+    }
+
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(TO_CON_Global.HkTlm.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(TO_CON_Global.HkTlm.TelemetryHeader), true);
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(TO_CON_Global.StreamStatsTlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(TO_CON_Global.StreamStatsTlm.TelemetryHeader), true);
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_AddPacketCmd() -- Subscribe to a telemetry stream        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_AddPacketCmd(const TO_CON_AddPacketCmd_t *data)
+{
+    const TO_CON_AddPacket_Payload_t *pCmd = &data->Payload;
+    CFE_Status_t                      status;
+
+    status = TO_CON_StreamSubscribe(pCmd->Stream, pCmd->Flags, pCmd->BufLimit);
+
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(TO_CON_ADDPKT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't subscribe 0x%x status %i", __LINE__,
+                          (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), (int)status);
+        ++TO_CON_Global.HkTlm.Payload.CommandErrorCounter;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(TO_CON_ADDPKT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "L%d TO AddPkt 0x%x, QoS %d.%d, limit %d", __LINE__,
+                          (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), pCmd->Flags.Priority,
+                          pCmd->Flags.Reliability, pCmd->BufLimit);
+        ++TO_CON_Global.HkTlm.Payload.CommandCounter;
+    }
+
+    return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RemovePacketCmd() -- Unsubscribe a telemetry stream      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_RemovePacketCmd(const TO_CON_RemovePacketCmd_t *data)
+{
+    const TO_CON_RemovePacket_Payload_t *pCmd = &data->Payload;
+    CFE_Status_t                         status;
+
+    status = TO_CON_StreamUnsubscribe(pCmd->Stream);
+
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(TO_CON_REMOVEPKT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't Unsubscribe to Stream 0x%x, status %i", __LINE__,
+                          (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream), (int)status);
+        ++TO_CON_Global.HkTlm.Payload.CommandErrorCounter;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(TO_CON_REMOVEPKT_INF_EID, CFE_EVS_EventType_INFORMATION, "L%d TO RemovePkt 0x%x",
+                          __LINE__, (unsigned int)CFE_SB_MsgIdToValue(pCmd->Stream));
+        ++TO_CON_Global.HkTlm.Payload.CommandCounter;
+    }
+
+    return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RemoveAllCmd() -- Unsubscribe every telemetry stream     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_RemoveAllCmd(const TO_CON_RemoveAllCmd_t *data)
+{
+    TO_CON_StreamUnsubscribeAll();
+
+    CFE_EVS_SendEvent(TO_CON_REMOVEALLPKTS_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "L%d TO Unsubscribed to all Telemetry", __LINE__);
+    ++TO_CON_Global.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_EnableOutputCmd() -- Send the output to a UDP address    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_EnableOutputCmd(const TO_CON_EnableOutputCmd_t *data)
+{
+    char         DestIP[sizeof(data->Payload.dest_IP) + 1];
+    CFE_Status_t status;
+
+    /* The command field need not be NUL terminated */
+    memcpy(DestIP, data->Payload.dest_IP, sizeof(data->Payload.dest_IP));
+    DestIP[sizeof(DestIP) - 1] = '\0';
+
+    status = TO_CON_UdpSetDestination(DestIP);
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(TO_CON_UDP_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't send output to %s:%u status %i", __LINE__, DestIP,
+                          (unsigned int)TO_CON_TLM_PORT, (int)status);
+        ++TO_CON_Global.HkTlm.Payload.CommandErrorCounter;
+        return status;
+    }
+
+    if (DestIP[0] == '\0')
+    {
+        CFE_EVS_SendEvent(TO_CON_UDP_INF_EID, CFE_EVS_EventType_INFORMATION, "TO UDP output disabled");
+    }
+    else
+    {
+        CFE_EVS_SendEvent(TO_CON_UDP_INF_EID, CFE_EVS_EventType_INFORMATION, "TO UDP output to %s:%u", DestIP,
+                          (unsigned int)TO_CON_TLM_PORT);
+    }
+
+    ++TO_CON_Global.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_SetEncoderCmd() -- Switch a sink's output encoder        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_SetEncoderCmd(const TO_CON_SetEncoderCmd_t *data)
+{
+    uint8          EncoderMode = data->Payload.EncoderMode;
+    uint8          SinkNum     = data->Payload.Sink;
+    TO_CON_Sink_t *Sink;
+
+    if (SinkNum >= TO_CON_SINK_COUNT)
+    {
+        CFE_EVS_SendEvent(TO_CON_ENCODER_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Invalid output sink %u",
+                          __LINE__, (unsigned int)SinkNum);
+        ++TO_CON_Global.HkTlm.Payload.CommandErrorCounter;
+        return CFE_STATUS_RANGE_ERROR;
+    }
+
+    if (EncoderMode >= TO_CON_ENCODER_COUNT)
+    {
+        CFE_EVS_SendEvent(TO_CON_ENCODER_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Invalid encoder mode %u",
+                          __LINE__, (unsigned int)EncoderMode);
+        ++TO_CON_Global.HkTlm.Payload.CommandErrorCounter;
+        return CFE_STATUS_RANGE_ERROR;
+    }
+
+#if (TO_CON_CONSOLE_STDIO == 0)
+    /* OS_printf stops at the first NUL, so binary frames cannot go to the OSAL console */
+    if (SinkNum == TO_CON_SINK_CONSOLE && EncoderMode == TO_CON_ENCODER_BINARY)
+    {
+        CFE_EVS_SendEvent(TO_CON_ENCODER_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Binary console output needs TO_CON_CONSOLE_STDIO", __LINE__);
+        ++TO_CON_Global.HkTlm.Payload.CommandErrorCounter;
+        return CFE_STATUS_RANGE_ERROR;
+    }
+#endif
+
+    /* Takes effect from the next packet; batches already queued keep their encoding */
+    Sink              = &TO_CON_Global.Output.Sinks[SinkNum];
+    Sink->EncoderMode = EncoderMode;
+
+    CFE_EVS_SendEvent(TO_CON_ENCODER_INF_EID, CFE_EVS_EventType_INFORMATION, "TO %s encoder mode set to %s",
+                      Sink->Def->Name, TO_CON_Encoders[EncoderMode].Name);
+    ++TO_CON_Global.HkTlm.Payload.CommandCounter;
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_SetEventFilterCmd() -- Set the least severe event output */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_SetEventFilterCmd(const TO_CON_SetEventFilterCmd_t *data)
+{
+    uint8 MinEventType = data->Payload.MinEventType;
+
+    if (MinEventType < CFE_EVS_EventType_DEBUG || MinEventType > CFE_EVS_EventType_CRITICAL)
+    {
+        CFE_EVS_SendEvent(TO_CON_EVTFILTER_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Invalid event type %u",
+                          __LINE__, (unsigned int)MinEventType);
+        ++TO_CON_Global.HkTlm.Payload.CommandErrorCounter;
+        return CFE_STATUS_RANGE_ERROR;
+    }
+
+    TO_CON_Global.EventMinType = MinEventType;
+
+    CFE_EVS_SendEvent(TO_CON_EVTFILTER_INF_EID, CFE_EVS_EventType_INFORMATION, "TO least severe event type set to %u",
+                      (unsigned int)MinEventType);
+    ++TO_CON_Global.HkTlm.Payload.CommandCounter;
     return CFE_SUCCESS;
 }
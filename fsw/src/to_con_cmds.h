@@ -36,6 +36,12 @@
 CFE_Status_t TO_CON_NoopCmd(const TO_CON_NoopCmd_t *data);
 CFE_Status_t TO_CON_ResetCountersCmd(const TO_CON_ResetCountersCmd_t *data);
 CFE_Status_t TO_CON_SendHkCmd(const TO_CON_SendHkCmd_t *data);
+CFE_Status_t TO_CON_AddPacketCmd(const TO_CON_AddPacketCmd_t *data);
+CFE_Status_t TO_CON_RemovePacketCmd(const TO_CON_RemovePacketCmd_t *data);
+CFE_Status_t TO_CON_RemoveAllCmd(const TO_CON_RemoveAllCmd_t *data);
+CFE_Status_t TO_CON_EnableOutputCmd(const TO_CON_EnableOutputCmd_t *data);
+CFE_Status_t TO_CON_SetEncoderCmd(const TO_CON_SetEncoderCmd_t *data);
+CFE_Status_t TO_CON_SetEventFilterCmd(const TO_CON_SetEventFilterCmd_t *data);
 
 
 
@@ -0,0 +1,440 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the decoders TO Console registers for itself
+ *
+ *  Mission apps that are not listed here can call TO_CON_RegisterDecoder()
+ *  from their own initialization instead.
+ */
+
+#include "cfe.h"
+#include "cfe_msgids.h"
+#include "cfe_es_msg.h"
+#include "cfe_evs_msg.h"
+#include "cfe_sb_msg.h"
+#include "cfe_tbl_msg.h"
+#include "cfe_time_msg.h"
+
+#include "to_con_app.h"
+#include "to_con_encode.h"
+#include "to_con_registry.h"
+#include "to_con_msgids.h"
+
+#ifdef HAVE_MXM_APP
+#include "mxm_app_msgids.h"
+#include "mxm_app_msgstruct.h"
+#endif
+
+#ifdef HAVE_HUFF_APP
+#include "huff_app_msgids.h"
+#include "huff_app_msgstruct.h"
+#endif
+
+/**
+ * Built-in registry entry
+ */
+typedef struct
+{
+    CFE_SB_MsgId_Atom_t MsgIdValue;
+    const char *        Name;
+    TO_CON_DecodeFunc_t DecodeFunc;
+    size_t              ExpectedSize;
+
+    const TO_CON_FieldLayout_t *Layout; /**< Used instead of DecodeFunc when set */
+} TO_CON_BuiltinDecoder_t;
+
+/*
+ * Event type names, indexed by CFE_EVS_EventType_*
+ */
+static const char *const TO_CON_EventTypeNames[] = {
+    [CFE_EVS_EventType_DEBUG]       = "DEBUG",
+    [CFE_EVS_EventType_INFORMATION] = "INFO",
+    [CFE_EVS_EventType_ERROR]       = "ERROR",
+    [CFE_EVS_EventType_CRITICAL]    = "CRIT",
+};
+
+/* "app=" <name> " eid=" <digits> " type=" <name> */
+#define TO_CON_EVENT_ID_TEXT_BYTES \
+    (4 + sizeof(((CFE_EVS_PacketID_t *)0)->AppName) + 5 + TO_CON_MAX_DECIMAL_DIGITS + 6 + 5)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_EventTextLength() -- Length of a char array, up to a NUL */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline size_t TO_CON_EventTextLength(const char *Text, size_t Size)
+{
+    const char *End = memchr(Text, '\0', Size);
+
+    return (End != NULL) ? (size_t)(End - Text) : Size;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RenderEventId() -- Who sent an event, and how severe     */
+/*                                                                 */
+/* Writes up to TO_CON_EVENT_ID_TEXT_BYTES characters and no       */
+/* terminator.  Returns the number of characters written.          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static size_t TO_CON_RenderEventId(char *TextBuf, const CFE_EVS_PacketID_t *PacketID)
+{
+    const char *TypeName = NULL;
+    size_t      Length;
+    size_t      NameLength;
+
+    memcpy(TextBuf, "app=", 4);
+    Length = 4;
+
+    /* AppName is not terminated when it fills the whole array */
+    NameLength = TO_CON_EventTextLength(PacketID->AppName, sizeof(PacketID->AppName));
+    memcpy(&TextBuf[Length], PacketID->AppName, NameLength);
+    Length += NameLength;
+
+    memcpy(&TextBuf[Length], " eid=", 5);
+    Length += 5;
+    Length += TO_CON_FormatDecimal(&TextBuf[Length], PacketID->EventID);
+
+    memcpy(&TextBuf[Length], " type=", 6);
+    Length += 6;
+
+    if (PacketID->EventType < (sizeof(TO_CON_EventTypeNames) / sizeof(TO_CON_EventTypeNames[0])))
+    {
+        TypeName = TO_CON_EventTypeNames[PacketID->EventType];
+    }
+
+    if (TypeName != NULL)
+    {
+        NameLength = strlen(TypeName);
+        memcpy(&TextBuf[Length], TypeName, NameLength);
+        Length += NameLength;
+    }
+    else
+    {
+        /* Five digits at most */
+        Length += TO_CON_FormatDecimal(&TextBuf[Length], PacketID->EventType);
+    }
+
+    return Length;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_DecodeLongEvent() -- Event sender, type and message text */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CFE_Status_t TO_CON_DecodeLongEvent(const CFE_SB_Buffer_t *SourceBuffer, char *TextBuf, size_t TextBufSize)
+{
+    const CFE_EVS_LongEventTlm_t *EventPtr = (const CFE_EVS_LongEventTlm_t *)SourceBuffer;
+    const char *                  Message  = EventPtr->Payload.Message;
+    size_t                        Length;
+    size_t                        MessageLength;
+    size_t                        i;
+
+    if (TextBufSize < (TO_CON_EVENT_ID_TEXT_BYTES + 1 + sizeof(EventPtr->Payload.Message) + 1))
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    Length            = TO_CON_RenderEventId(TextBuf, &EventPtr->Payload.PacketID);
+    TextBuf[Length++] = ' ';
+
+    /* The text goes last, as is, so it can hold spaces and '=' */
+    MessageLength = TO_CON_EventTextLength(Message, sizeof(EventPtr->Payload.Message));
+    for (i = 0; i < MessageLength; i++)
+    {
+        /* Control characters would break the one line per packet output */
+        TextBuf[Length++] = ((uint8)Message[i] < 0x20) ? ' ' : Message[i];
+    }
+
+    TextBuf[Length] = '\0';
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_DecodeShortEvent() -- Event sender and type, no text     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CFE_Status_t TO_CON_DecodeShortEvent(const CFE_SB_Buffer_t *SourceBuffer, char *TextBuf, size_t TextBufSize)
+{
+    const CFE_EVS_ShortEventTlm_t *EventPtr = (const CFE_EVS_ShortEventTlm_t *)SourceBuffer;
+    size_t                         Length;
+
+    if (TextBufSize < (TO_CON_EVENT_ID_TEXT_BYTES + 1))
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    Length          = TO_CON_RenderEventId(TextBuf, &EventPtr->Payload.PacketID);
+    TextBuf[Length] = '\0';
+    return CFE_SUCCESS;
+}
+
+#ifdef HAVE_MXM_APP
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_DecodeMxmResult() -- MXM result string                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CFE_Status_t TO_CON_DecodeMxmResult(const CFE_SB_Buffer_t *SourceBuffer, char *TextBuf, size_t TextBufSize)
+{
+    const MXM_APP_ResultTlm_t *MxmAppResultTlmPtr = (const MXM_APP_ResultTlm_t *)SourceBuffer;
+    int32                      status;
+
+    status = CFE_SB_MessageStringGet(TextBuf, MxmAppResultTlmPtr->Payload.ResultStr, NULL, TextBufSize,
+                                     sizeof(MxmAppResultTlmPtr->Payload.ResultStr));
+
+    return (status == CFE_SB_BAD_ARGUMENT) ? status : CFE_SUCCESS;
+}
+#endif
+
+#ifdef HAVE_HUFF_APP
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_DecodeHuffResult() -- HUFF result string                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CFE_Status_t TO_CON_DecodeHuffResult(const CFE_SB_Buffer_t *SourceBuffer, char *TextBuf, size_t TextBufSize)
+{
+    const HUFF_APP_ResultTlm_t *HuffAppResultTlmPtr = (const HUFF_APP_ResultTlm_t *)SourceBuffer;
+    int32                       status;
+
+    status = CFE_SB_MessageStringGet(TextBuf, HuffAppResultTlmPtr->Payload.ResultStr, NULL, TextBufSize,
+                                     sizeof(HuffAppResultTlmPtr->Payload.ResultStr));
+
+    return (status == CFE_SB_BAD_ARGUMENT) ? status : CFE_SUCCESS;
+}
+#endif
+
+/*
+ * Field layouts for the cFE core housekeeping packets.  Array members
+ * (per-app, per-pipe and per-block statistics) are left out to keep the
+ * lines readable.
+ */
+static const TO_CON_FieldDesc_t TO_CON_EsHkFields[] = {
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, CommandCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, CommandErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, CFECoreChecksum, TO_CON_FIELD_HEX),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, CFEMajorVersion, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, CFEMinorVersion, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, CFERevision, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, CFEMissionRevision, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, OSALMajorVersion, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, OSALMinorVersion, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, OSALRevision, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, OSALMissionRevision, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PSPMajorVersion, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PSPMinorVersion, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PSPRevision, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PSPMissionRevision, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, SysLogBytesUsed, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, SysLogSize, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, SysLogEntries, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, SysLogMode, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, ERLogIndex, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, ERLogEntries, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, RegisteredCoreApps, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, RegisteredExternalApps, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, RegisteredTasks, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, RegisteredLibs, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, ResetType, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, ResetSubtype, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, ProcessorResets, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, MaxProcessorResets, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, BootSource, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PerfState, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PerfMode, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PerfTriggerCount, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PerfDataStart, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PerfDataEnd, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PerfDataCount, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, PerfDataToWrite, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, HeapBytesFree, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, HeapBlocksFree, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_HousekeepingTlm_t, HeapMaxBlockSize, TO_CON_FIELD_UNSIGNED),
+};
+
+static const TO_CON_FieldDesc_t TO_CON_EvsHkFields[] = {
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, CommandCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, CommandErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, MessageFormatMode, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, MessageTruncCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, UnregisteredAppCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, OutputPort, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, LogFullFlag, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, LogMode, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, MessageSendCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, LogOverflowCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_EVS_HousekeepingTlm_t, LogEnabled, TO_CON_FIELD_UNSIGNED),
+};
+
+static const TO_CON_FieldDesc_t TO_CON_SbHkFields[] = {
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, CommandCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, CommandErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, NoSubscribersCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, MsgSendErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, MsgReceiveErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, InternalErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, CreatePipeErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, SubscribeErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, PipeOptsErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, DuplicateSubscriptionsCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, GetPipeIdByNameErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, PipeOverflowErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, MsgLimitErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, MemPoolHandle, TO_CON_FIELD_HEX),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, MemInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_HousekeepingTlm_t, UnmarkedMem, TO_CON_FIELD_UNSIGNED),
+};
+
+static const TO_CON_FieldDesc_t TO_CON_TblHkFields[] = {
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, CommandCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, CommandErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, NumTables, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, NumLoadPending, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, ValidationCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, LastValCrc, TO_CON_FIELD_HEX),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, LastValStatus, TO_CON_FIELD_SIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, ActiveBuffer, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, LastValTableName, TO_CON_FIELD_STRING),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, SuccessValCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, FailedValCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, NumValRequests, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, NumFreeSharedBufs, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, MemPoolHandle, TO_CON_FIELD_HEX),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, LastUpdateTime.Seconds, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, LastUpdatedTable, TO_CON_FIELD_STRING),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, LastFileLoaded, TO_CON_FIELD_STRING),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, LastFileDumped, TO_CON_FIELD_STRING),
+    TO_CON_PAYLOAD_FIELD(CFE_TBL_HousekeepingTlm_t, LastTableLoaded, TO_CON_FIELD_STRING),
+};
+
+static const TO_CON_FieldDesc_t TO_CON_TimeHkFields[] = {
+    TO_CON_PAYLOAD_FIELD(CFE_TIME_HousekeepingTlm_t, CommandCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TIME_HousekeepingTlm_t, CommandErrorCounter, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TIME_HousekeepingTlm_t, ClockStateFlags, TO_CON_FIELD_HEX),
+    TO_CON_PAYLOAD_FIELD(CFE_TIME_HousekeepingTlm_t, ClockStateAPI, TO_CON_FIELD_SIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TIME_HousekeepingTlm_t, LeapSeconds, TO_CON_FIELD_SIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TIME_HousekeepingTlm_t, SecondsMET, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TIME_HousekeepingTlm_t, SubsecsMET, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TIME_HousekeepingTlm_t, SecondsSTCF, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_TIME_HousekeepingTlm_t, SubsecsSTCF, TO_CON_FIELD_UNSIGNED),
+};
+
+static const TO_CON_FieldDesc_t TO_CON_SbStatsFields[] = {
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, MsgIdsInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, PeakMsgIdsInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, MaxMsgIdsAllowed, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, PipesInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, PeakPipesInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, MaxPipesAllowed, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, MemInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, PeakMemInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, MaxMemAllowed, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, SubscriptionsInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, PeakSubscriptionsInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, MaxSubscriptionsAllowed, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, SBBuffersInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, PeakSBBuffersInUse, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_SB_StatsTlm_t, MaxPipeDepthAllowed, TO_CON_FIELD_UNSIGNED),
+};
+
+static const TO_CON_FieldDesc_t TO_CON_EsMemStatsFields[] = {
+    TO_CON_PAYLOAD_FIELD(CFE_ES_MemStatsTlm_t, PoolHandle, TO_CON_FIELD_HEX),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_MemStatsTlm_t, PoolStats.PoolSize, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_MemStatsTlm_t, PoolStats.NumBlocksRequested, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_MemStatsTlm_t, PoolStats.CheckErrCtr, TO_CON_FIELD_UNSIGNED),
+    TO_CON_PAYLOAD_FIELD(CFE_ES_MemStatsTlm_t, PoolStats.NumFreeBytes, TO_CON_FIELD_UNSIGNED),
+};
+
+static const TO_CON_FieldLayout_t TO_CON_EsHkLayout = TO_CON_FIELD_LAYOUT(CFE_ES_HousekeepingTlm_t, TO_CON_EsHkFields);
+static const TO_CON_FieldLayout_t TO_CON_EvsHkLayout =
+    TO_CON_FIELD_LAYOUT(CFE_EVS_HousekeepingTlm_t, TO_CON_EvsHkFields);
+static const TO_CON_FieldLayout_t TO_CON_SbHkLayout = TO_CON_FIELD_LAYOUT(CFE_SB_HousekeepingTlm_t, TO_CON_SbHkFields);
+static const TO_CON_FieldLayout_t TO_CON_TblHkLayout =
+    TO_CON_FIELD_LAYOUT(CFE_TBL_HousekeepingTlm_t, TO_CON_TblHkFields);
+static const TO_CON_FieldLayout_t TO_CON_TimeHkLayout =
+    TO_CON_FIELD_LAYOUT(CFE_TIME_HousekeepingTlm_t, TO_CON_TimeHkFields);
+static const TO_CON_FieldLayout_t TO_CON_SbStatsLayout = TO_CON_FIELD_LAYOUT(CFE_SB_StatsTlm_t, TO_CON_SbStatsFields);
+static const TO_CON_FieldLayout_t TO_CON_EsMemStatsLayout =
+    TO_CON_FIELD_LAYOUT(CFE_ES_MemStatsTlm_t, TO_CON_EsMemStatsFields);
+
+static const TO_CON_BuiltinDecoder_t TO_CON_BuiltinDecoders[] = {
+    {TO_CON_HK_TLM_MID, "TO_HK", NULL, 0, NULL},
+    {TO_CON_STREAM_STATS_TLM_MID, "TO_STREAM_STATS", NULL, 0, NULL},
+
+    /* cFE Core */
+    {CFE_ES_HK_TLM_MID, "ES_HK", NULL, 0, &TO_CON_EsHkLayout},
+    {CFE_EVS_HK_TLM_MID, "EVS_HK", NULL, 0, &TO_CON_EvsHkLayout},
+    {CFE_SB_HK_TLM_MID, "SB_HK", NULL, 0, &TO_CON_SbHkLayout},
+    {CFE_TBL_HK_TLM_MID, "TBL_HK", NULL, 0, &TO_CON_TblHkLayout},
+    {CFE_TIME_HK_TLM_MID, "TIME_HK", NULL, 0, &TO_CON_TimeHkLayout},
+    {CFE_TIME_DIAG_TLM_MID, "TIME_DIAG", NULL, 0, NULL},
+    {CFE_SB_STATS_TLM_MID, "SB_STATS", NULL, 0, &TO_CON_SbStatsLayout},
+    {CFE_TBL_REG_TLM_MID, "TBL_REG", NULL, 0, NULL},
+    {CFE_EVS_LONG_EVENT_MSG_MID, "EVS_LONG_EVENT", TO_CON_DecodeLongEvent, sizeof(CFE_EVS_LongEventTlm_t), NULL},
+    {CFE_EVS_SHORT_EVENT_MSG_MID, "EVS_SHORT_EVENT", TO_CON_DecodeShortEvent, sizeof(CFE_EVS_ShortEventTlm_t), NULL},
+    {CFE_ES_APP_TLM_MID, "ES_APP", NULL, 0, NULL},
+    {CFE_ES_MEMSTATS_TLM_MID, "ES_MEMSTATS", NULL, 0, &TO_CON_EsMemStatsLayout},
+
+#ifdef HAVE_MXM_APP
+    {MXM_APP_HK_TLM_MID, "MXM_HK", NULL, 0, NULL},
+    {MXM_APP_RES_TLM_MID, "MXM_RES", TO_CON_DecodeMxmResult, sizeof(MXM_APP_ResultTlm_t), NULL},
+#endif
+#ifdef HAVE_HUFF_APP
+    {HUFF_APP_HK_TLM_MID, "HUFF_HK", NULL, 0, NULL},
+    {HUFF_APP_RES_TLM_MID, "HUFF_RES", TO_CON_DecodeHuffResult, sizeof(HUFF_APP_ResultTlm_t), NULL},
+#endif
+};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RegisterBuiltinDecoders() -- Register the table above    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_RegisterBuiltinDecoders(void)
+{
+    const TO_CON_BuiltinDecoder_t *Builtin;
+    CFE_Status_t                   Status;
+    uint32                         i;
+
+    for (i = 0; i < (sizeof(TO_CON_BuiltinDecoders) / sizeof(TO_CON_BuiltinDecoders[0])); ++i)
+    {
+        Builtin = &TO_CON_BuiltinDecoders[i];
+
+        if (Builtin->Layout != NULL)
+        {
+            Status = TO_CON_RegisterFieldDecoder(CFE_SB_ValueToMsgId(Builtin->MsgIdValue), Builtin->Name,
+                                                 Builtin->Layout);
+        }
+        else
+        {
+            Status = TO_CON_RegisterDecoder(CFE_SB_ValueToMsgId(Builtin->MsgIdValue), Builtin->Name,
+                                            Builtin->DecodeFunc, Builtin->ExpectedSize);
+        }
+        if (Status != CFE_SUCCESS)
+        {
+            return Status;
+        }
+    }
+
+    return CFE_SUCCESS;
+}
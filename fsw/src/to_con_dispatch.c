@@ -41,6 +41,32 @@
    command.
 */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  TO_CON_VerifyCmdLength() -- Check a command's length           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool TO_CON_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
+{
+    CFE_MSG_FcnCode_t CommandCode  = 0;
+    size_t            ActualLength = 0;
+
+    CFE_MSG_GetSize(MsgPtr, &ActualLength);
+
+    if (ActualLength != ExpectedLength)
+    {
+        CFE_MSG_GetFcnCode(MsgPtr, &CommandCode);
+
+        CFE_EVS_SendEvent(TO_CON_CMD_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO: Invalid Msg length: CC = %u, Len = %u, Expected = %u", __LINE__,
+                          (unsigned int)CommandCode, (unsigned int)ActualLength, (unsigned int)ExpectedLength);
+        ++TO_CON_Global.HkTlm.Payload.CommandErrorCounter;
+        return false;
+    }
+
+    return true;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /*  TO_CON_ProcessGroundCommand() -- Process local message           */
@@ -62,6 +88,48 @@ void TO_CON_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr)
             TO_CON_ResetCountersCmd((const TO_CON_ResetCountersCmd_t *)SBBufPtr);
             break;
 
+        case TO_CON_ADD_PKT_CC:
+            if (TO_CON_VerifyCmdLength(&SBBufPtr->Msg, sizeof(TO_CON_AddPacketCmd_t)))
+            {
+                TO_CON_AddPacketCmd((const TO_CON_AddPacketCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case TO_CON_REMOVE_PKT_CC:
+            if (TO_CON_VerifyCmdLength(&SBBufPtr->Msg, sizeof(TO_CON_RemovePacketCmd_t)))
+            {
+                TO_CON_RemovePacketCmd((const TO_CON_RemovePacketCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case TO_CON_REMOVE_ALL_PKT_CC:
+            if (TO_CON_VerifyCmdLength(&SBBufPtr->Msg, sizeof(TO_CON_RemoveAllCmd_t)))
+            {
+                TO_CON_RemoveAllCmd((const TO_CON_RemoveAllCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case TO_CON_ENABLE_OUTPUT_CC:
+            if (TO_CON_VerifyCmdLength(&SBBufPtr->Msg, sizeof(TO_CON_EnableOutputCmd_t)))
+            {
+                TO_CON_EnableOutputCmd((const TO_CON_EnableOutputCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case TO_CON_SET_ENCODER_CC:
+            if (TO_CON_VerifyCmdLength(&SBBufPtr->Msg, sizeof(TO_CON_SetEncoderCmd_t)))
+            {
+                TO_CON_SetEncoderCmd((const TO_CON_SetEncoderCmd_t *)SBBufPtr);
+            }
+            break;
+
+        case TO_CON_SET_EVENT_FILTER_CC:
+            if (TO_CON_VerifyCmdLength(&SBBufPtr->Msg, sizeof(TO_CON_SetEventFilterCmd_t)))
+            {
+                TO_CON_SetEventFilterCmd((const TO_CON_SetEventFilterCmd_t *)SBBufPtr);
+            }
+            break;
+
         default:
             CFE_EVS_SendEvent(TO_CON_FNCODE_ERR_EID, CFE_EVS_EventType_ERROR,
                               "L%d TO: Invalid Function Code Rcvd In Ground Command 0x%x", __LINE__,
@@ -0,0 +1,33 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the TO Console encoder table
+ */
+
+#include "to_con_encode.h"
+
+/*
+ * Indexed by TO_CON_ENCODER_* mode
+ */
+const TO_CON_Encoder_t TO_CON_Encoders[TO_CON_ENCODER_COUNT] = {
+    [TO_CON_ENCODER_TEXT]   = {"TEXT", TO_CON_StringfyOutputMessage},
+    [TO_CON_ENCODER_BINARY] = {"BINARY", TO_CON_PassthroughOutputMessage},
+    [TO_CON_ENCODER_JSON]   = {"JSON", TO_CON_JsonOutputMessage},
+};
@@ -28,13 +28,67 @@
 #include "cfe_msg.h"
 #include "cfe_error.h"
 
+#include "to_con_msg.h"
+#include "to_con_streams.h"
+
+/******************************************************************************/
+
+/*
+** Macro Definitions
+*/
+
+/* Longest number from TO_CON_FormatDecimal(): the 20 digits of a uint64 */
+#define TO_CON_MAX_DECIMAL_DIGITS 20
+
+/* Worst case TO_CON_JsonEscape() output per input byte: \u00XX */
+#define TO_CON_JSON_ESCAPE_RATIO 6
+
+/******************************************************************************/
+
+/*
+** Type Definitions
+*/
+
+/**
+ * Encoder callback
+ *
+ * Sets DestBufferOut/DestSizeOut to the bytes to output for SourceBuffer.
+ * The output stays valid until the next call to the same encoder, or
+ * until the next CFE_SB_ReceiveBuffer on the telemetry pipe.  Stream is
+ * the subscription the packet arrived on, or NULL if it has none.
+ */
+typedef CFE_Status_t (*TO_CON_EncodeFunc_t)(const CFE_SB_Buffer_t *SourceBuffer, const TO_CON_Stream_t *Stream,
+                                            int64 TimeMillis, const void **DestBufferOut, size_t *DestSizeOut);
+
+typedef struct
+{
+    const char *        Name;
+    TO_CON_EncodeFunc_t EncodeFunc;
+} TO_CON_Encoder_t;
+
 /******************************************************************************/
 
 /*
 ** Prototypes Section
 */
-CFE_Status_t TO_CON_StringfyOutputMessage(const CFE_SB_Buffer_t *SourceBuffer, const char **DestBufferOut,
-                                        size_t *DestSizeOut);
+CFE_Status_t TO_CON_StringfyOutputMessage(const CFE_SB_Buffer_t *SourceBuffer, const TO_CON_Stream_t *Stream,
+                                          int64 TimeMillis, const void **DestBufferOut, size_t *DestSizeOut);
+CFE_Status_t TO_CON_PassthroughOutputMessage(const CFE_SB_Buffer_t *SourceBuffer, const TO_CON_Stream_t *Stream,
+                                             int64 TimeMillis, const void **DestBufferOut, size_t *DestSizeOut);
+CFE_Status_t TO_CON_JsonOutputMessage(const CFE_SB_Buffer_t *SourceBuffer, const TO_CON_Stream_t *Stream,
+                                      int64 TimeMillis, const void **DestBufferOut, size_t *DestSizeOut);
+
+/*
+** Text kernels shared by the encoders; none of them writes a terminator
+*/
+size_t TO_CON_HexEncode(char *Dest, const void *Src, size_t Len);
+size_t TO_CON_FormatDecimal(char *Dest, uint64 Value);
+size_t TO_CON_JsonEscape(char *Dest, const char *Src, size_t Len);
+
+/*
+** Encoders indexed by TO_CON_ENCODER_* mode
+*/
+extern const TO_CON_Encoder_t TO_CON_Encoders[TO_CON_ENCODER_COUNT];
 
 /******************************************************************************/
 
@@ -0,0 +1,308 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the descriptor-driven field decoder
+ *
+ *  A field layout lists {name, offset, size, type} for each field of a
+ *  message.  One loop renders any layout as "key=value key=value ...", and
+ *  another as JSON members, so supporting another packet only needs
+ *  another layout.
+ */
+
+#include "cfe.h"
+
+#include "to_con_registry.h"
+#include "to_con_encode.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FieldLoad() -- Read an integer field of 1 to 8 bytes     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint64 TO_CON_FieldLoad(const uint8 *Src, uint16 Size)
+{
+    uint8  Value8;
+    uint16 Value16;
+    uint32 Value32;
+    uint64 Value64 = 0;
+
+    switch (Size)
+    {
+        case sizeof(uint8):
+            memcpy(&Value8, Src, sizeof(Value8));
+            return Value8;
+        case sizeof(uint16):
+            memcpy(&Value16, Src, sizeof(Value16));
+            return Value16;
+        case sizeof(uint32):
+            memcpy(&Value32, Src, sizeof(Value32));
+            return Value32;
+        case sizeof(uint64):
+            memcpy(&Value64, Src, sizeof(Value64));
+            return Value64;
+        default:
+            return 0;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RenderNumber() -- Render an integer field's value        */
+/*                                                                 */
+/* Dest must have room for TO_CON_MAX_DECIMAL_DIGITS + 2           */
+/* characters.  Returns the number of characters written.          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static size_t TO_CON_RenderNumber(char *Dest, const TO_CON_FieldDesc_t *Field, const uint8 *Src)
+{
+    size_t Length = 0;
+    uint64 Value;
+    uint32 Shift;
+    uint8  Byte;
+
+    switch (Field->Type)
+    {
+        case TO_CON_FIELD_UNSIGNED:
+            Length = TO_CON_FormatDecimal(Dest, TO_CON_FieldLoad(Src, Field->Size));
+            break;
+
+        case TO_CON_FIELD_SIGNED:
+            /* Sign extend from the field width */
+            Shift = 64 - (8 * Field->Size);
+            Value = (uint64)((int64)(TO_CON_FieldLoad(Src, Field->Size) << Shift) >> Shift);
+            if ((int64)Value < 0)
+            {
+                Dest[Length++] = '-';
+                Value          = 0 - Value;
+            }
+            Length += TO_CON_FormatDecimal(&Dest[Length], Value);
+            break;
+
+        case TO_CON_FIELD_HEX:
+            /* Most significant byte first, whatever the host byte order */
+            Value          = TO_CON_FieldLoad(Src, Field->Size);
+            Dest[Length++] = '0';
+            Dest[Length++] = 'x';
+            for (Shift = 8 * Field->Size; Shift != 0; Shift -= 8)
+            {
+                Byte = (uint8)(Value >> (Shift - 8));
+                Length += TO_CON_HexEncode(&Dest[Length], &Byte, 1);
+            }
+            break;
+
+        default:
+            Dest[Length++] = '?';
+            break;
+    }
+
+    return Length;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FieldStringLength() -- Length of a char array field      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline size_t TO_CON_FieldStringLength(const TO_CON_FieldDesc_t *Field, const uint8 *Src)
+{
+    const uint8 *End = memchr(Src, '\0', Field->Size);
+
+    return (End != NULL) ? (size_t)(End - Src) : Field->Size;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RenderFields() -- Render a message as key=value pairs    */
+/*                                                                 */
+/* Stops at the first field that might not fit, so the output is   */
+/* always made of whole fields.  TextBuf is NUL terminated.        */
+/* Returns the length of the text.  The layout was checked when it */
+/* was registered and the message size by the caller, so there are */
+/* no per-field bounds checks here.                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t TO_CON_RenderFields(const TO_CON_FieldLayout_t *Layout, const CFE_SB_Buffer_t *SourceBuffer, char *TextBuf,
+                           size_t TextBufSize)
+{
+    const TO_CON_FieldDesc_t *Field;
+    const uint8 *             Base = (const uint8 *)SourceBuffer;
+    const uint8 *             Src;
+    size_t                    Length = 0;
+    size_t                    Worst;
+    size_t                    StringLength;
+    size_t                    j;
+    uint16                    i;
+
+    if (TextBufSize == 0)
+    {
+        return 0;
+    }
+
+    for (i = 0; i < Layout->NumFields; i++)
+    {
+        Field = &Layout->Fields[i];
+        Src   = &Base[Field->Offset];
+
+        /* Separator, name, '=', value and the final NUL */
+        Worst = 1 + Field->NameLen + 1 + 1;
+        Worst += (Field->Type == TO_CON_FIELD_STRING) ? Field->Size : (TO_CON_MAX_DECIMAL_DIGITS + 2);
+        if (Length + Worst > TextBufSize)
+        {
+            break;
+        }
+
+        if (Length != 0)
+        {
+            TextBuf[Length++] = ' ';
+        }
+
+        memcpy(&TextBuf[Length], Field->Name, Field->NameLen);
+        Length += Field->NameLen;
+        TextBuf[Length++] = '=';
+
+        if (Field->Type == TO_CON_FIELD_STRING)
+        {
+            StringLength = TO_CON_FieldStringLength(Field, Src);
+            for (j = 0; j < StringLength; j++)
+            {
+                /* Control characters would break the one line per packet output */
+                TextBuf[Length++] = (Src[j] < 0x20) ? ' ' : (char)Src[j];
+            }
+        }
+        else
+        {
+            Length += TO_CON_RenderNumber(&TextBuf[Length], Field, Src);
+        }
+    }
+
+    TextBuf[Length] = '\0';
+    return Length;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RenderFieldsJson() -- Render a message as JSON members   */
+/*                                                                 */
+/* Writes "name":value pairs separated by commas, without the      */
+/* enclosing braces.  Hex fields and strings are JSON strings, the */
+/* other integers JSON numbers.  Like TO_CON_RenderFields() it     */
+/* stops at the first field that might not fit.  No terminator is  */
+/* written.  Returns the number of characters written.             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t TO_CON_RenderFieldsJson(const TO_CON_FieldLayout_t *Layout, const CFE_SB_Buffer_t *SourceBuffer, char *Dest,
+                               size_t DestSize)
+{
+    const TO_CON_FieldDesc_t *Field;
+    const uint8 *             Base = (const uint8 *)SourceBuffer;
+    const uint8 *             Src;
+    size_t                    Length = 0;
+    size_t                    Worst;
+    uint16                    i;
+
+    for (i = 0; i < Layout->NumFields; i++)
+    {
+        Field = &Layout->Fields[i];
+        Src   = &Base[Field->Offset];
+
+        /* Separator, quoted name, ':' and a value that may be quoted */
+        Worst = 1 + 1 + Field->NameLen + 1 + 1 + 2;
+        Worst += (Field->Type == TO_CON_FIELD_STRING) ? (TO_CON_JSON_ESCAPE_RATIO * (size_t)Field->Size)
+                                                      : (TO_CON_MAX_DECIMAL_DIGITS + 2);
+        if (Length + Worst > DestSize)
+        {
+            break;
+        }
+
+        if (Length != 0)
+        {
+            Dest[Length++] = ',';
+        }
+
+        /* Field names are C identifiers and never need escaping */
+        Dest[Length++] = '"';
+        memcpy(&Dest[Length], Field->Name, Field->NameLen);
+        Length += Field->NameLen;
+        Dest[Length++] = '"';
+        Dest[Length++] = ':';
+
+        if (Field->Type == TO_CON_FIELD_STRING)
+        {
+            Dest[Length++] = '"';
+            Length += TO_CON_JsonEscape(&Dest[Length], (const char *)Src, TO_CON_FieldStringLength(Field, Src));
+            Dest[Length++] = '"';
+        }
+        else if (Field->Type == TO_CON_FIELD_HEX)
+        {
+            /* JSON numbers cannot be hex, and 64 bit values would lose precision as doubles */
+            Dest[Length++] = '"';
+            Length += TO_CON_RenderNumber(&Dest[Length], Field, Src);
+            Dest[Length++] = '"';
+        }
+        else
+        {
+            Length += TO_CON_RenderNumber(&Dest[Length], Field, Src);
+        }
+    }
+
+    return Length;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_ValidateFieldLayout() -- Check a layout once, up front   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool TO_CON_ValidateFieldLayout(const TO_CON_FieldLayout_t *Layout)
+{
+    const TO_CON_FieldDesc_t *Field;
+    uint16                    i;
+
+    for (i = 0; i < Layout->NumFields; i++)
+    {
+        Field = &Layout->Fields[i];
+
+        if (Field->Name == NULL || ((size_t)Field->Offset + Field->Size) > Layout->MinSize)
+        {
+            return false;
+        }
+
+        switch (Field->Type)
+        {
+            case TO_CON_FIELD_UNSIGNED:
+            case TO_CON_FIELD_SIGNED:
+            case TO_CON_FIELD_HEX:
+                if (Field->Size != sizeof(uint8) && Field->Size != sizeof(uint16) && Field->Size != sizeof(uint32) &&
+                    Field->Size != sizeof(uint64))
+                {
+                    return false;
+                }
+                break;
+
+            case TO_CON_FIELD_STRING:
+                break;
+
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,304 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the TO Console rotating log file
+ *
+ *  The file sink's writer task hands every batch queued for it to this
+ *  file.  Batches collect in a write-behind buffer that goes to
+ *  disk when it fills or every TO_CON_FILE_SYNC_MSEC, so the file costs
+ *  one OS_write per buffer rather than per line.  The file is rotated by
+ *  size or age, keeping at most TO_CON_FILE_MAX_FILES of them.
+ */
+
+#include <stdio.h>
+
+#include "cfe.h"
+
+#include "to_con_app.h"
+#include "to_con_file.h"
+#include "to_con_eventids.h"
+
+#if (TO_CON_FILE_BUFFER_BYTES < TO_CON_OUTPUT_BATCH_BYTES)
+#error TO_CON_FILE_BUFFER_BYTES must be at least TO_CON_OUTPUT_BATCH_BYTES
+#endif
+
+#if (TO_CON_FILE_MAX_FILES < 1) || (TO_CON_FILE_MAX_FILES > 99)
+#error TO_CON_FILE_MAX_FILES must be between 1 and 99
+#endif
+
+/* How often to try again after the log file could not be opened or written */
+#define TO_CON_FILE_RETRY_MSEC 10000
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FileName() -- Path of the Nth newest log file            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_FileName(char *Path, size_t PathSize, uint32 Age)
+{
+    if (Age == 0)
+    {
+        snprintf(Path, PathSize, "%s", TO_CON_FILE_PATH);
+    }
+    else
+    {
+        snprintf(Path, PathSize, "%s.%u", TO_CON_FILE_PATH, (unsigned int)Age);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FileShift() -- Age every kept file by one                */
+/*                                                                 */
+/* Missing files are normal, so rename errors are ignored.         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_FileShift(void)
+{
+    char   OldPath[OS_MAX_PATH_LEN];
+    char   NewPath[OS_MAX_PATH_LEN];
+    uint32 Age;
+
+    TO_CON_FileName(OldPath, sizeof(OldPath), TO_CON_FILE_MAX_FILES - 1);
+    OS_remove(OldPath);
+
+    for (Age = TO_CON_FILE_MAX_FILES - 1; Age > 0; Age--)
+    {
+        TO_CON_FileName(OldPath, sizeof(OldPath), Age - 1);
+        TO_CON_FileName(NewPath, sizeof(NewPath), Age);
+        OS_rename(OldPath, NewPath);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FileFail() -- Give up on the current file after an error */
+/*                                                                 */
+/* Only the first error after a successful open is reported, so a  */
+/* full or missing disk does not flood the event log.              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_FileFail(const char *What, int32 OsStatus)
+{
+    TO_CON_File_t *File = &TO_CON_Global.File;
+
+    if (!File->ErrorReported)
+    {
+        CFE_EVS_SendEvent(TO_CON_FILE_ERR_EID, CFE_EVS_EventType_ERROR, "TO Can't %s log file %s status %i", What,
+                          TO_CON_FILE_PATH, (int)OsStatus);
+        File->ErrorReported = true;
+    }
+
+    if (OS_ObjectIdDefined(File->Fd))
+    {
+        OS_close(File->Fd);
+        File->Fd = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    File->BufLen = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FileOpen() -- Start a new log file                       */
+/*                                                                 */
+/* The previous file, if any, is kept as the newest old file.  A   */
+/* retry after a failed create does not age the old files again,   */
+/* so a full or missing disk does not delete the logs that show    */
+/* what went wrong.                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_FileOpen(int64 NowMillis)
+{
+    TO_CON_File_t *File = &TO_CON_Global.File;
+    int32          OsStatus;
+
+    if (!TO_CON_FILE_SINK_ENABLED)
+    {
+        return;
+    }
+
+    File->LastOpenMillis = NowMillis;
+
+    if (!File->CreateFailed)
+    {
+        TO_CON_FileShift();
+    }
+
+    OsStatus = OS_OpenCreate(&File->Fd, TO_CON_FILE_PATH, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                             OS_WRITE_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        File->Fd           = OS_OBJECT_ID_UNDEFINED;
+        File->CreateFailed = true;
+        TO_CON_FileFail("create", OsStatus);
+        return;
+    }
+
+    if (File->ErrorReported)
+    {
+        CFE_EVS_SendEvent(TO_CON_FILE_INF_EID, CFE_EVS_EventType_INFORMATION, "TO log file %s reopened",
+                          TO_CON_FILE_PATH);
+        File->ErrorReported = false;
+    }
+
+    File->CreateFailed   = false;
+    File->FileBytes      = 0;
+    File->BufLen         = 0;
+    File->OpenedMillis   = NowMillis;
+    File->LastSyncMillis = NowMillis;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FileSync() -- Write out the write-behind buffer          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_FileSync(int64 NowMillis)
+{
+    TO_CON_File_t *File = &TO_CON_Global.File;
+    int32          OsStatus;
+
+    File->LastSyncMillis = NowMillis;
+
+    if (File->BufLen == 0)
+    {
+        return;
+    }
+
+    OsStatus = OS_write(File->Fd, File->Buffer, File->BufLen);
+    if (OsStatus != (int32)File->BufLen)
+    {
+        TO_CON_FileFail("write", OsStatus);
+        return;
+    }
+
+    File->FileBytes += File->BufLen;
+    File->BufLen = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FileRotate() -- Close the current file and start another */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_FileRotate(int64 NowMillis)
+{
+    TO_CON_File_t *File = &TO_CON_Global.File;
+
+    TO_CON_FileSync(NowMillis);
+
+    if (OS_ObjectIdDefined(File->Fd))
+    {
+        OS_close(File->Fd);
+        File->Fd = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    TO_CON_FileOpen(NowMillis);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FileWrite() -- Append one batch to the log file          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_FileWrite(const void *Data, size_t Len, int64 NowMillis)
+{
+    TO_CON_File_t *File = &TO_CON_Global.File;
+
+    if (!OS_ObjectIdDefined(File->Fd))
+    {
+        return;
+    }
+
+    if ((File->FileBytes + File->BufLen + Len) > TO_CON_FILE_MAX_BYTES && (File->FileBytes + File->BufLen) != 0)
+    {
+        TO_CON_FileRotate(NowMillis);
+        if (!OS_ObjectIdDefined(File->Fd))
+        {
+            return;
+        }
+    }
+
+    if ((File->BufLen + Len) > sizeof(File->Buffer))
+    {
+        TO_CON_FileSync(NowMillis);
+        if (!OS_ObjectIdDefined(File->Fd))
+        {
+            return;
+        }
+    }
+
+    memcpy(&File->Buffer[File->BufLen], Data, Len);
+    File->BufLen += Len;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FilePoll() -- Timed work: sync, rotation by age, retry   */
+/*                                                                 */
+/* Called by the writer task on every wakeup.                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_FilePoll(int64 NowMillis)
+{
+    TO_CON_File_t *File = &TO_CON_Global.File;
+
+    if (!OS_ObjectIdDefined(File->Fd))
+    {
+        if (TO_CON_FILE_SINK_ENABLED && (NowMillis - File->LastOpenMillis) >= TO_CON_FILE_RETRY_MSEC)
+        {
+            TO_CON_FileOpen(NowMillis);
+        }
+        return;
+    }
+
+    if (TO_CON_FILE_MAX_AGE_SEC != 0 && (NowMillis - File->OpenedMillis) >= (int64)TO_CON_FILE_MAX_AGE_SEC * 1000 &&
+        (File->FileBytes + File->BufLen) != 0)
+    {
+        TO_CON_FileRotate(NowMillis);
+    }
+    else if ((NowMillis - File->LastSyncMillis) >= TO_CON_FILE_SYNC_MSEC)
+    {
+        TO_CON_FileSync(NowMillis);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FileClose() -- Write out what is buffered and close      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_FileClose(void)
+{
+    TO_CON_File_t *File = &TO_CON_Global.File;
+
+    if (!OS_ObjectIdDefined(File->Fd))
+    {
+        return;
+    }
+
+    TO_CON_FileSync(File->LastSyncMillis);
+    if (OS_ObjectIdDefined(File->Fd))
+    {
+        OS_close(File->Fd);
+        File->Fd = OS_OBJECT_ID_UNDEFINED;
+    }
+}
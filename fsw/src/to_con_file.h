@@ -0,0 +1,64 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define TO Console rotating log file
+ */
+
+#ifndef TO_CON_FILE_H
+#define TO_CON_FILE_H
+
+#include "common_types.h"
+#include "osapi.h"
+#include "cfe.h"
+
+#include "to_con_platform_cfg.h"
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * Log file state, only ever touched by the writer task
+ */
+typedef struct
+{
+    osal_id_t Fd;
+    bool      ErrorReported; /**< An error event was sent and the file has not been reopened since */
+    bool      CreateFailed;  /**< The last open failed, so there is no new file to age on a retry */
+
+    size_t FileBytes;      /**< Written to the current file, excluding Buffer */
+    int64  OpenedMillis;   /**< When the current file was created */
+    int64  LastSyncMillis; /**< When Buffer was last written out */
+    int64  LastOpenMillis; /**< Last attempt to open a file, for retries */
+
+    size_t BufLen;
+    char   Buffer[TO_CON_FILE_BUFFER_BYTES];
+} TO_CON_File_t;
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+void TO_CON_FileOpen(int64 NowMillis);
+void TO_CON_FileWrite(const void *Data, size_t Len, int64 NowMillis);
+void TO_CON_FilePoll(int64 NowMillis);
+void TO_CON_FileClose(void);
+
+#endif
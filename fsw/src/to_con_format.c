@@ -0,0 +1,176 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the number and byte to text kernels shared by the
+ *  encoders
+ *
+ *  Each one writes straight into the caller's line buffer and returns the
+ *  number of characters written, so an encoder can build a whole line
+ *  without snprintf or intermediate copies.
+ */
+
+#include <string.h>
+
+#include "common_types.h"
+
+#include "to_con_encode.h"
+
+/*
+ * Two hex digits for each byte value, so each input byte costs one table
+ * load and a two byte store with no per-nibble arithmetic or branching.
+ */
+static const char TO_CON_HexPairs[512 + 1] =
+    "000102030405060708090A0B0C0D0E0F"
+    "101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F"
+    "303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F"
+    "505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F"
+    "707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F"
+    "909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAF"
+    "B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF"
+    "D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF"
+    "F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+/* Two decimal digits for each value 0..99, halving the divisions per number */
+static const char TO_CON_DecimalPairs[200 + 1] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/*
+ * JSON escape for each control character: the letter of its short form,
+ * or 'u' where only the \u00XX form exists.
+ */
+static const char TO_CON_JsonControlEscapes[0x20] = {
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_HexEncode() -- Render bytes as upper case hex digits     */
+/*                                                                 */
+/* Dest must have room for 2 * Len characters.  No terminator is   */
+/* written.  Returns the number of characters written.             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t TO_CON_HexEncode(char *Dest, const void *Src, size_t Len)
+{
+    const uint8 *Bytes = Src;
+    size_t       i;
+
+    for (i = 0; i < Len; i++)
+    {
+        memcpy(&Dest[2 * i], &TO_CON_HexPairs[2 * Bytes[i]], 2);
+    }
+
+    return 2 * Len;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FormatDecimal() -- Render an unsigned value in decimal   */
+/*                                                                 */
+/* Dest must have room for TO_CON_MAX_DECIMAL_DIGITS characters.   */
+/* No terminator is written.  Returns the number of characters     */
+/* written.                                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t TO_CON_FormatDecimal(char *Dest, uint64 Value)
+{
+    char   Digits[TO_CON_MAX_DECIMAL_DIGITS];
+    size_t Pos = sizeof(Digits);
+
+    while (Value >= 100)
+    {
+        Pos -= 2;
+        memcpy(&Digits[Pos], &TO_CON_DecimalPairs[2 * (Value % 100)], 2);
+        Value /= 100;
+    }
+
+    if (Value >= 10)
+    {
+        Pos -= 2;
+        memcpy(&Digits[Pos], &TO_CON_DecimalPairs[2 * Value], 2);
+    }
+    else
+    {
+        Digits[--Pos] = (char)('0' + Value);
+    }
+
+    memcpy(Dest, &Digits[Pos], sizeof(Digits) - Pos);
+    return sizeof(Digits) - Pos;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_JsonEscape() -- Copy text as the inside of a JSON string */
+/*                                                                 */
+/* Quotes, backslashes and control characters are escaped.  Bytes  */
+/* outside ASCII are written as \u00XX, so the output is always     */
+/* valid JSON even when the input is not UTF-8.  Dest must have    */
+/* room for TO_CON_JSON_ESCAPE_RATIO * Len characters.  No         */
+/* terminator is written.  Returns the number of characters        */
+/* written.                                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t TO_CON_JsonEscape(char *Dest, const char *Src, size_t Len)
+{
+    size_t Length = 0;
+    size_t i;
+    uint8  Char;
+
+    for (i = 0; i < Len; i++)
+    {
+        Char = (uint8)Src[i];
+
+        /* Printable ASCII is by far the common case */
+        if (Char >= 0x20 && Char < 0x7F && Char != '"' && Char != '\\')
+        {
+            Dest[Length++] = (char)Char;
+        }
+        else if (Char == '"' || Char == '\\')
+        {
+            Dest[Length++] = '\\';
+            Dest[Length++] = (char)Char;
+        }
+        else if (Char < 0x20 && TO_CON_JsonControlEscapes[Char] != 'u')
+        {
+            Dest[Length++] = '\\';
+            Dest[Length++] = TO_CON_JsonControlEscapes[Char];
+        }
+        else
+        {
+            memcpy(&Dest[Length], "\\u00", 4);
+            memcpy(&Dest[Length + 4], &TO_CON_HexPairs[2 * Char], 2);
+            Length += 6;
+        }
+    }
+
+    return Length;
+}
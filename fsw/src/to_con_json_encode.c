@@ -0,0 +1,211 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the JSON Lines encoder for the TO Console application
+ *
+ *  Each packet becomes one JSON object on its own line:
+ *
+ *      {"time":T,"msgid":"0xID","name":"N","size":S,"fields":{...}}
+ *
+ *  with "fields" for packets that have a field layout, "text" for those
+ *  with a decoder callback and "payload" for hex dumps.  The line is built
+ *  directly in a static buffer with the shared text kernels; there is no
+ *  heap allocation and no snprintf.
+ */
+
+#include "cfe_sb.h"
+#include "cfe_msg.h"
+
+#include "to_con_app.h"
+#include "to_con_eventids.h"
+#include "to_con_encode.h"
+#include "to_con_registry.h"
+
+/* Object start through "size", with the name escaped */
+#define MAX_TO_JSON_PREFIX_BYTES (64 + (TO_CON_JSON_ESCAPE_RATIO * TO_CON_DECODER_NAME_LEN) + \
+                                  (2 * TO_CON_MAX_DECIMAL_DIGITS))
+
+/* Decoder callback output, staged before it is escaped into the line */
+#define MAX_TO_JSON_TEXT_BYTES 512
+
+/* "fields" members; a little larger than the text form for the quotes */
+#define MAX_TO_JSON_FIELDS_BYTES 2048
+
+/* Longest member after "size", key and closing characters included */
+#define MAX_TO_JSON_BODY_BYTES (16 + (TO_CON_JSON_ESCAPE_RATIO * MAX_TO_JSON_TEXT_BYTES))
+
+#if (MAX_TO_JSON_FIELDS_BYTES + 16 > MAX_TO_JSON_BODY_BYTES) || \
+    ((2 * TO_CON_MAX_DUMP_BYTES) + 16 > MAX_TO_JSON_BODY_BYTES)
+#error MAX_TO_JSON_BODY_BYTES is too small for the fields or payload members
+#endif
+
+/*
+ * --------------------------------------------
+ * Appends a string literal that is known to need no escaping
+ * --------------------------------------------
+ */
+#define TO_CON_JSON_APPEND(Dest, Length, Literal)                  \
+    do                                                             \
+    {                                                              \
+        memcpy(&(Dest)[(Length)], (Literal), sizeof(Literal) - 1); \
+        (Length) += sizeof(Literal) - 1;                           \
+    } while (0)
+
+/*
+ * --------------------------------------------
+ * Appends the message ID as a quoted hex string of at least four digits
+ * --------------------------------------------
+ */
+static size_t TO_CON_JsonMsgId(char *Dest, uint32 MsgIdValue)
+{
+    uint8  Bytes[4];
+    size_t First;
+    size_t Length = 0;
+
+    Bytes[0] = (uint8)(MsgIdValue >> 24);
+    Bytes[1] = (uint8)(MsgIdValue >> 16);
+    Bytes[2] = (uint8)(MsgIdValue >> 8);
+    Bytes[3] = (uint8)MsgIdValue;
+
+    First = (MsgIdValue > 0xFFFF) ? ((MsgIdValue > 0xFFFFFF) ? 0 : 1) : 2;
+
+    TO_CON_JSON_APPEND(Dest, Length, "\"0x");
+    Length += TO_CON_HexEncode(&Dest[Length], &Bytes[First], sizeof(Bytes) - First);
+    Dest[Length++] = '"';
+
+    return Length;
+}
+
+/*
+ * --------------------------------------------
+ * This implements an "encoder" that renders each message as one JSON object.
+ *
+ * Names and decoders come from the registry, exactly as for the text encoder,
+ * and the caller supplies the timestamp.
+ * --------------------------------------------
+ */
+CFE_Status_t TO_CON_JsonOutputMessage(const CFE_SB_Buffer_t *SourceBuffer, const TO_CON_Stream_t *Stream,
+                                      int64 TimeMillis, const void **DestBufferOut, size_t *DestSizeOut)
+{
+    static char                  LineBuffer[MAX_TO_JSON_PREFIX_BYTES + MAX_TO_JSON_BODY_BYTES];
+    static char                  DecodeText[MAX_TO_JSON_TEXT_BYTES];
+    const TO_CON_DecoderEntry_t *Entry;
+    const char *                 MessageName;
+    CFE_SB_MsgId_t               MsgId   = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_Size_t               MsgSize = 0;
+    uint32                       MsgIdValue;
+    size_t                       DumpLength;
+    size_t                       Length = 0;
+    int32                        status;
+
+    CFE_MSG_GetMsgId(&SourceBuffer->Msg, &MsgId);
+    CFE_MSG_GetSize(&SourceBuffer->Msg, &MsgSize);
+    MsgIdValue = CFE_SB_MsgIdToValue(MsgId);
+
+    Entry       = TO_CON_RegistryLookup(MsgId);
+    MessageName = (Entry == NULL) ? "unknown" : Entry->Name;
+
+    TO_CON_JSON_APPEND(LineBuffer, Length, "{\"time\":");
+    if (TimeMillis < 0)
+    {
+        LineBuffer[Length++] = '-';
+        Length += TO_CON_FormatDecimal(&LineBuffer[Length], (uint64)0 - (uint64)TimeMillis);
+    }
+    else
+    {
+        Length += TO_CON_FormatDecimal(&LineBuffer[Length], (uint64)TimeMillis);
+    }
+
+    TO_CON_JSON_APPEND(LineBuffer, Length, ",\"msgid\":");
+    Length += TO_CON_JsonMsgId(&LineBuffer[Length], MsgIdValue);
+
+    TO_CON_JSON_APPEND(LineBuffer, Length, ",\"name\":\"");
+    Length += TO_CON_JsonEscape(&LineBuffer[Length], MessageName, strlen(MessageName));
+
+    TO_CON_JSON_APPEND(LineBuffer, Length, "\",\"size\":");
+    Length += TO_CON_FormatDecimal(&LineBuffer[Length], MsgSize);
+
+    if (Entry != NULL && Entry->Layout != NULL)
+    {
+        if (MsgSize < Entry->Layout->MinSize)
+        {
+            CFE_EVS_SendEvent(TO_CON_ENCODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid Msg length: ID = 0x%X,  Len = %u, Expected at least %u",
+                              (unsigned int)MsgIdValue, (unsigned int)MsgSize, (unsigned int)Entry->Layout->MinSize);
+        }
+        else
+        {
+            TO_CON_JSON_APPEND(LineBuffer, Length, ",\"fields\":{");
+            Length += TO_CON_RenderFieldsJson(Entry->Layout, SourceBuffer, &LineBuffer[Length],
+                                              MAX_TO_JSON_FIELDS_BYTES);
+            LineBuffer[Length++] = '}';
+        }
+    }
+    else if (Entry != NULL && Entry->DecodeFunc != NULL)
+    {
+        if (Entry->ExpectedSize != 0 && MsgSize != Entry->ExpectedSize)
+        {
+            CFE_EVS_SendEvent(TO_CON_ENCODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid Msg length: ID = 0x%X,  Len = %u, Expected = %u", (unsigned int)MsgIdValue,
+                              (unsigned int)MsgSize, (unsigned int)Entry->ExpectedSize);
+        }
+        else
+        {
+            /* Decoders produce free text, which has to be escaped on its way into the line */
+            DecodeText[0] = '\0';
+            status        = Entry->DecodeFunc(SourceBuffer, DecodeText, sizeof(DecodeText));
+            if (status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(TO_CON_ENCODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Failed retrieve message content: 0x%08lx", (unsigned long)status);
+            }
+            else
+            {
+                DecodeText[sizeof(DecodeText) - 1] = '\0';
+
+                TO_CON_JSON_APPEND(LineBuffer, Length, ",\"text\":\"");
+                Length += TO_CON_JsonEscape(&LineBuffer[Length], DecodeText, strlen(DecodeText));
+                LineBuffer[Length++] = '"';
+            }
+        }
+    }
+    else if (Stream != NULL && Stream->DumpBytes != 0 && MsgSize > sizeof(CFE_MSG_TelemetryHeader_t))
+    {
+        /* Payload bytes after the telemetry header, as in the text encoder's dump */
+        DumpLength = MsgSize - sizeof(CFE_MSG_TelemetryHeader_t);
+        if (DumpLength > Stream->DumpBytes)
+        {
+            DumpLength = Stream->DumpBytes;
+        }
+
+        TO_CON_JSON_APPEND(LineBuffer, Length, ",\"payload\":\"");
+        Length += TO_CON_HexEncode(&LineBuffer[Length], (const uint8 *)SourceBuffer + sizeof(CFE_MSG_TelemetryHeader_t),
+                                   DumpLength);
+        LineBuffer[Length++] = '"';
+    }
+
+    LineBuffer[Length++] = '}';
+    LineBuffer[Length++] = '\n';
+
+    *DestBufferOut = LineBuffer;
+    *DestSizeOut   = Length;
+
+    return CFE_SUCCESS;
+}
@@ -0,0 +1,247 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the end-to-end latency histograms
+ *
+ *  Latency is the time a batch was written to the console minus the CCSDS
+ *  header time of each packet in it, so it covers the time spent in the
+ *  telemetry pipe, the encoder and the output ring.
+ */
+
+#include "cfe.h"
+
+#include "to_con_app.h"
+#include "to_con_latency.h"
+
+#define TO_CON_LATENCY_LOAD(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define TO_CON_LATENCY_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define TO_CON_LATENCY_TAKE(p)     __atomic_exchange_n((p), false, __ATOMIC_ACQ_REL)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_LatencyBucket() -- Histogram bucket for a latency        */
+/*                                                                 */
+/* 0 and 1 ms have their own buckets; above that each power of two */
+/* is split in two halves.                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint32 TO_CON_LatencyBucket(uint32 Msec)
+{
+    uint32 Exponent;
+    uint32 Bucket;
+
+    if (Msec < 2)
+    {
+        return Msec;
+    }
+
+    Exponent = 31 - (uint32)__builtin_clz(Msec);
+    Bucket   = (2 * Exponent) + ((Msec >> (Exponent - 1)) & 1);
+
+    return (Bucket < TO_CON_LATENCY_BUCKETS) ? Bucket : (TO_CON_LATENCY_BUCKETS - 1);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_LatencyBucketLimit() -- Largest latency in a bucket      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint32 TO_CON_LatencyBucketLimit(uint32 Bucket)
+{
+    uint32 Exponent;
+
+    if (Bucket < 2)
+    {
+        return Bucket;
+    }
+
+    Exponent = Bucket / 2;
+    return (1U << Exponent) + ((Bucket & 1) + 1) * (1U << (Exponent - 1)) - 1;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_LatencyHistAdd() -- Add one sample to a histogram        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline void TO_CON_LatencyHistAdd(TO_CON_LatencyHist_t *Hist, uint32 Msec)
+{
+    ++Hist->Counts[TO_CON_LatencyBucket(Msec)];
+
+    if (Msec > Hist->MaxMsec)
+    {
+        Hist->MaxMsec = Msec;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_LatencyRecord() -- Record the latency of one packet      */
+/*                                                                 */
+/* Called from the console sink's writer task only.                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_LatencyRecord(uint16 StreamSlot, int64 LatencyMsec)
+{
+    TO_CON_Latency_t *Latency = &TO_CON_Global.Latency;
+    uint32            Msec;
+
+    /* Header time ahead of the local clock reads as zero latency */
+    if (LatencyMsec < 0)
+    {
+        Msec = 0;
+    }
+    else if (LatencyMsec > 0xFFFFFFFF)
+    {
+        Msec = 0xFFFFFFFF;
+    }
+    else
+    {
+        Msec = (uint32)LatencyMsec;
+    }
+
+    TO_CON_LatencyHistAdd(&Latency->Overall, Msec);
+
+    if (StreamSlot < TO_CON_MAX_SUBSCRIPTIONS)
+    {
+        TO_CON_LatencyHistAdd(&Latency->Streams[StreamSlot], Msec);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_LatencyApplyResets() -- Clear histograms as requested    */
+/*                                                                 */
+/* Called from the console sink's writer task only.                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_LatencyApplyResets(void)
+{
+    TO_CON_Latency_t *Latency = &TO_CON_Global.Latency;
+    uint32            i;
+
+    if (!TO_CON_LATENCY_TAKE(&Latency->AnyResetPending))
+    {
+        return;
+    }
+
+    if (TO_CON_LATENCY_TAKE(&Latency->OverallResetPending))
+    {
+        memset(&Latency->Overall, 0, sizeof(Latency->Overall));
+    }
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        if (TO_CON_LATENCY_TAKE(&Latency->StreamResetPending[i]))
+        {
+            memset(&Latency->Streams[i], 0, sizeof(Latency->Streams[i]));
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_LatencyResetAll() -- Request a reset of every histogram  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_LatencyResetAll(void)
+{
+    TO_CON_Latency_t *Latency = &TO_CON_Global.Latency;
+    uint32            i;
+
+    TO_CON_LATENCY_STORE(&Latency->OverallResetPending, true);
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        TO_CON_LATENCY_STORE(&Latency->StreamResetPending[i], true);
+    }
+    TO_CON_LATENCY_STORE(&Latency->AnyResetPending, true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_LatencyResetStream() -- Request a reset of one stream    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_LatencyResetStream(uint16 StreamSlot)
+{
+    TO_CON_Latency_t *Latency = &TO_CON_Global.Latency;
+
+    if (StreamSlot < TO_CON_MAX_SUBSCRIPTIONS)
+    {
+        TO_CON_LATENCY_STORE(&Latency->StreamResetPending[StreamSlot], true);
+        TO_CON_LATENCY_STORE(&Latency->AnyResetPending, true);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_LatencyPercentile() -- Latency below which Percent of    */
+/*                               the samples fall                  */
+/*                                                                 */
+/* Reports the upper limit of the bucket, capped at the maximum    */
+/* seen.  The writer task may be adding samples meanwhile, which   */
+/* can only skew the result by those few samples.                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 TO_CON_LatencyPercentile(const TO_CON_LatencyHist_t *Hist, uint32 Percent)
+{
+    uint32 Counts[TO_CON_LATENCY_BUCKETS];
+    uint64 Total = 0;
+    uint64 Rank;
+    uint64 Seen = 0;
+    uint32 MaxMsec;
+    uint32 i;
+
+    for (i = 0; i < TO_CON_LATENCY_BUCKETS; i++)
+    {
+        Counts[i] = TO_CON_LATENCY_LOAD(&Hist->Counts[i]);
+        Total += Counts[i];
+    }
+    MaxMsec = TO_CON_LATENCY_LOAD(&Hist->MaxMsec);
+
+    if (Total == 0)
+    {
+        return 0;
+    }
+
+    /* Rank of the sample, rounded up so that p100 is the last one */
+    Rank = ((Total * Percent) + 99) / 100;
+    if (Rank == 0)
+    {
+        Rank = 1;
+    }
+
+    for (i = 0; i < TO_CON_LATENCY_BUCKETS; i++)
+    {
+        Seen += Counts[i];
+        if (Seen >= Rank)
+        {
+            break;
+        }
+    }
+
+    /* The last bucket has no upper limit */
+    if (i >= (TO_CON_LATENCY_BUCKETS - 1) || TO_CON_LatencyBucketLimit(i) > MaxMsec)
+    {
+        return MaxMsec;
+    }
+
+    return TO_CON_LatencyBucketLimit(i);
+}
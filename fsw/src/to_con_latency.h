@@ -0,0 +1,98 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define TO Console end-to-end latency histograms
+ */
+
+#ifndef TO_CON_LATENCY_H
+#define TO_CON_LATENCY_H
+
+#include "common_types.h"
+#include "cfe.h"
+
+#include "to_con_platform_cfg.h"
+
+/************************************************************************
+** Macro Definitions
+*************************************************************************/
+
+/**
+ * Histogram buckets are log-scale with two buckets per power of two
+ * milliseconds, so a percentile is accurate to within a quarter of its
+ * value.  The last bucket also holds everything above ~65 s.
+ */
+#define TO_CON_LATENCY_BUCKETS 32
+
+/**
+ * Stream slot for packets that belong to no subscription, counted in the
+ * overall histogram only
+ */
+#define TO_CON_LATENCY_NO_STREAM 0xFFFF
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * Latency histogram, in milliseconds
+ */
+typedef struct
+{
+    uint32 Counts[TO_CON_LATENCY_BUCKETS];
+    uint32 MaxMsec;
+} TO_CON_LatencyHist_t;
+
+/**
+ * Latency state, overall and per subscription slot
+ *
+ * The histograms are only written by the writer task.  Other tasks ask for
+ * a reset through the ResetPending flags, which the writer task acts on
+ * before it records the next batch.
+ */
+typedef struct
+{
+    TO_CON_LatencyHist_t Overall;
+    TO_CON_LatencyHist_t Streams[TO_CON_MAX_SUBSCRIPTIONS];
+
+    bool AnyResetPending;
+    bool OverallResetPending;
+    bool StreamResetPending[TO_CON_MAX_SUBSCRIPTIONS];
+} TO_CON_Latency_t;
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+void   TO_CON_LatencyRecord(uint16 StreamSlot, int64 LatencyMsec);
+void   TO_CON_LatencyApplyResets(void);
+void   TO_CON_LatencyResetAll(void);
+void   TO_CON_LatencyResetStream(uint16 StreamSlot);
+uint32 TO_CON_LatencyPercentile(const TO_CON_LatencyHist_t *Hist, uint32 Percent);
+
+/**
+ * Converts a CFE time to milliseconds, the unit of the latency histograms
+ */
+static inline int64 TO_CON_TimeToMillis(CFE_TIME_SysTime_t Time)
+{
+    /* Subseconds are 2^-32 s */
+    return ((int64)Time.Seconds * 1000) + (int64)(((uint64)Time.Subseconds * 1000) >> 32);
+}
+
+#endif
@@ -0,0 +1,278 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the output sink rings and writer tasks
+ *
+ *  The TO_CON main task only ever appends encoded lines to a batch in a
+ *  sink's ring, so a slow sink can never stall the software bus drain
+ *  loop.  Every sink has its own ring and child task, which takes whole
+ *  batches out of the ring and hands each one to the sink in one call;
+ *  a sink that falls behind only drops its own output.
+ */
+
+#include "cfe.h"
+
+#include "to_con_app.h"
+#include "to_con_output.h"
+#include "to_con_eventids.h"
+#include "to_con_file.h"
+#include "to_con_udp.h"
+
+#if ((TO_CON_OUTPUT_RING_DEPTH & (TO_CON_OUTPUT_RING_DEPTH - 1)) != 0)
+#error TO_CON_OUTPUT_RING_DEPTH must be a power of two
+#endif
+
+#if (TO_CON_OUTPUT_BATCH_BYTES > 0xFFFF)
+#error TO_CON_OUTPUT_BATCH_BYTES must fit in a uint16
+#endif
+
+/*
+ * The ring indices are shared between two tasks.  Acquire/release ordering
+ * makes sure a slot's contents are visible before the index that publishes it.
+ */
+#define TO_CON_RING_LOAD(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define TO_CON_RING_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_OutputInit() -- Create the sink writer tasks             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_OutputInit(void)
+{
+    TO_CON_Output_t *       Output = &TO_CON_Global.Output;
+    TO_CON_Sink_t *         Sink;
+    const TO_CON_SinkDef_t *Def;
+    CFE_Status_t            status;
+    int32                   OsStatus;
+    uint32                  i;
+
+    memset(Output, 0, sizeof(*Output));
+    memset(&TO_CON_Global.File, 0, sizeof(TO_CON_Global.File));
+    TO_CON_Global.File.Fd = OS_OBJECT_ID_UNDEFINED;
+
+    TO_CON_UdpInit();
+
+    for (i = 0; i < TO_CON_SINK_COUNT; i++)
+    {
+        Sink = &Output->Sinks[i];
+        Def  = &TO_CON_SinkDefs[i];
+
+        Sink->Def         = Def;
+        Sink->EncoderMode = Def->DefaultEncoderMode;
+        Sink->WakeSem     = OS_OBJECT_ID_UNDEFINED;
+
+        if (!Def->Available)
+        {
+            continue;
+        }
+
+        OsStatus = OS_BinSemCreate(&Sink->WakeSem, Def->SemName, 0, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            CFE_EVS_SendEvent(TO_CON_OUTPUT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO Can't create %s writer sem status %i", __LINE__, Def->Name, (int)OsStatus);
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+
+        status = CFE_ES_CreateChildTask(&Sink->TaskId, Def->TaskName, Def->TaskEntry, CFE_ES_TASK_STACK_ALLOCATE,
+                                        TO_CON_OUTPUT_TASK_STACK_SIZE, TO_CON_OUTPUT_TASK_PRIORITY, 0);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(TO_CON_OUTPUT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO Can't create %s writer task status %i", __LINE__, Def->Name, (int)status);
+            return status;
+        }
+
+        Sink->Enabled = Def->StartEnabled;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_OutputCommit() -- Hand the open batch to the writer      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_OutputCommit(TO_CON_Sink_t *Sink)
+{
+    uint32 Head;
+    uint32 Used;
+
+    if (!Sink->BatchOpen)
+    {
+        return;
+    }
+
+    Head = Sink->Ring.Head + 1;
+    TO_CON_RING_STORE(&Sink->Ring.Head, Head);
+    Sink->BatchOpen = false;
+
+    Used = Head - TO_CON_RING_LOAD(&Sink->Ring.Tail);
+    if (Used > Sink->HighWater)
+    {
+        Sink->HighWater = Used;
+    }
+
+    OS_BinSemGive(Sink->WakeSem);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_OutputPut() -- Append one encoded packet to a sink batch */
+/*                                                                 */
+/* Called from the TO_CON main task only.  Never blocks; returns   */
+/* false and counts a drop if the sink's ring is full or the data  */
+/* can never fit in a batch.                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool TO_CON_OutputPut(TO_CON_Sink_t *Sink, const void *Data, size_t Len, const TO_CON_OutputTag_t *Tag)
+{
+    TO_CON_OutputSlot_t *Slot;
+
+    /* Truncating would corrupt binary output, so oversize data is dropped */
+    if (Len > TO_CON_OUTPUT_BATCH_BYTES)
+    {
+        ++Sink->DropCount;
+        return false;
+    }
+
+    Slot = &Sink->Ring.Slots[Sink->Ring.Head & (TO_CON_OUTPUT_RING_DEPTH - 1)];
+
+    if (Sink->BatchOpen &&
+        ((Slot->Len + Len) > TO_CON_OUTPUT_BATCH_BYTES || Slot->Packets >= TO_CON_OUTPUT_BATCH_PACKETS))
+    {
+        TO_CON_OutputCommit(Sink);
+        Slot = &Sink->Ring.Slots[Sink->Ring.Head & (TO_CON_OUTPUT_RING_DEPTH - 1)];
+    }
+
+    if (!Sink->BatchOpen)
+    {
+        if ((Sink->Ring.Head - TO_CON_RING_LOAD(&Sink->Ring.Tail)) >= TO_CON_OUTPUT_RING_DEPTH)
+        {
+            ++Sink->DropCount;
+            return false;
+        }
+
+        Slot->Len       = 0;
+        Slot->Packets   = 0;
+        Sink->BatchOpen = true;
+    }
+
+    memcpy(&Slot->Data[Slot->Len], Data, Len);
+    Slot->Len += Len;
+    Slot->Tags[Slot->Packets]    = *Tag;
+    Slot->Lengths[Slot->Packets] = (uint16)Len;
+    ++Slot->Packets;
+
+    ++Sink->PacketsQueued;
+    Sink->BytesQueued += Len;
+
+    if (Slot->Len >= TO_CON_OUTPUT_FLUSH_BYTES)
+    {
+        TO_CON_OutputCommit(Sink);
+    }
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_OutputFlush() -- Hand over whatever is batched so far    */
+/*                                                                 */
+/* Called at the end of every drain pass.                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_OutputFlush(void)
+{
+    uint32 i;
+
+    for (i = 0; i < TO_CON_SINK_COUNT; i++)
+    {
+        TO_CON_OutputCommit(&TO_CON_Global.Output.Sinks[i]);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_OutputOccupancy() -- Batches waiting in a sink's ring    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 TO_CON_OutputOccupancy(const TO_CON_Sink_t *Sink)
+{
+    return TO_CON_RING_LOAD(&Sink->Ring.Head) - TO_CON_RING_LOAD(&Sink->Ring.Tail);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_OutputTask() -- Sink writer child task main loop         */
+/*                                                                 */
+/* Each sink's task entry point calls this with its own sink.      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_OutputTask(TO_CON_Sink_t *Sink)
+{
+    const TO_CON_SinkDef_t *Def = Sink->Def;
+    uint32                  Tail;
+    int32                   OsStatus;
+
+    if (Def->Start != NULL)
+    {
+        Def->Start(TO_CON_TimeToMillis(CFE_TIME_GetTime()));
+    }
+
+    while (true)
+    {
+        /* The timeout picks up anything queued while the last wakeup was being serviced */
+        OsStatus = OS_BinSemTimedWait(Sink->WakeSem, TO_CON_TASK_MSEC);
+        if (OsStatus != OS_SUCCESS && OsStatus != OS_SEM_TIMEOUT)
+        {
+            break;
+        }
+
+        Tail = Sink->Ring.Tail;
+        while (Tail != TO_CON_RING_LOAD(&Sink->Ring.Head))
+        {
+            if (Def->Write != NULL)
+            {
+                CFE_ES_PerfLogEntry(Def->PerfId);
+                Def->Write(&Sink->Ring.Slots[Tail & (TO_CON_OUTPUT_RING_DEPTH - 1)],
+                           TO_CON_TimeToMillis(CFE_TIME_GetTime()));
+                CFE_ES_PerfLogExit(Def->PerfId);
+            }
+
+            ++Tail;
+            TO_CON_RING_STORE(&Sink->Ring.Tail, Tail);
+        }
+
+        if (Def->Poll != NULL)
+        {
+            Def->Poll(TO_CON_TimeToMillis(CFE_TIME_GetTime()));
+        }
+    }
+
+    if (Def->Stop != NULL)
+    {
+        Def->Stop();
+    }
+
+    CFE_ES_ExitChildTask();
+}
@@ -0,0 +1,148 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define TO Console output sinks, their rings and writer tasks
+ */
+
+#ifndef TO_CON_OUTPUT_H
+#define TO_CON_OUTPUT_H
+
+#include "common_types.h"
+#include "osapi.h"
+#include "cfe.h"
+
+#include "to_con_platform_cfg.h"
+#include "to_con_msg.h"
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * Where a packet in a batch came from, for the latency histograms
+ */
+typedef struct
+{
+    int64  SourceMillis; /**< \brief CCSDS header time of the packet */
+    uint16 StreamSlot;   /**< \brief Subscription slot, or TO_CON_LATENCY_NO_STREAM */
+} TO_CON_OutputTag_t;
+
+/**
+ * One batch of encoded packets, written out with a single write
+ */
+typedef struct
+{
+    size_t Len;
+    uint32 Packets;
+    char   Data[TO_CON_OUTPUT_BATCH_BYTES];
+
+    TO_CON_OutputTag_t Tags[TO_CON_OUTPUT_BATCH_PACKETS];
+    uint16             Lengths[TO_CON_OUTPUT_BATCH_PACKETS]; /**< \brief Size of each packet in Data, in order */
+} TO_CON_OutputSlot_t;
+
+/**
+ * Single-producer/single-consumer ring between the drain loop and a writer task
+ *
+ * Head and Tail are free running; the slot index is the counter modulo
+ * TO_CON_OUTPUT_RING_DEPTH.  Head is only written by the TO_CON main task and
+ * Tail only by the writer task, so no lock is needed.
+ */
+typedef struct
+{
+    uint32 Head;
+    uint32 Tail;
+
+    TO_CON_OutputSlot_t Slots[TO_CON_OUTPUT_RING_DEPTH];
+} TO_CON_OutputRing_t;
+
+/**
+ * Static description of an output sink
+ *
+ * The hooks run in the sink's own writer task.  Start and Stop are called
+ * when the task starts and stops, Write for every batch and Poll on every
+ * wakeup.  Any of them may be NULL; a sink with no Write discards its
+ * output.
+ */
+typedef struct
+{
+    const char *                  Name;
+    const char *                  TaskName;
+    const char *                  SemName;
+    CFE_ES_ChildTaskMainFuncPtr_t TaskEntry;
+
+    bool  Available;          /**< \brief Configured in, so it gets a writer task */
+    bool  StartEnabled;       /**< \brief Gets packets from startup */
+    uint8 DefaultEncoderMode; /**< \brief TO_CON_ENCODER_* mode at startup */
+
+    uint32 PerfId; /**< \brief Performance marker around Write */
+
+    void (*Start)(int64 NowMillis);
+    void (*Write)(const TO_CON_OutputSlot_t *Slot, int64 NowMillis);
+    void (*Poll)(int64 NowMillis);
+    void (*Stop)(void);
+} TO_CON_SinkDef_t;
+
+/**
+ * One output sink: a ring, the writer task that empties it and its counters
+ *
+ * Everything except the ring's Tail belongs to the TO_CON main task.
+ */
+typedef struct
+{
+    const TO_CON_SinkDef_t *Def;
+    TO_CON_OutputRing_t     Ring;
+
+    bool  Enabled;
+    uint8 EncoderMode;
+    bool  BatchOpen;
+
+    uint32 HighWater;
+    uint32 DropCount;
+    uint32 PacketsQueued;
+    uint32 BytesQueued;
+
+    osal_id_t       WakeSem;
+    CFE_ES_TaskId_t TaskId;
+} TO_CON_Sink_t;
+
+/**
+ * Output state, one entry per TO_CON_SINK_*
+ */
+typedef struct
+{
+    TO_CON_Sink_t Sinks[TO_CON_SINK_COUNT];
+} TO_CON_Output_t;
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+CFE_Status_t TO_CON_OutputInit(void);
+bool   TO_CON_OutputPut(TO_CON_Sink_t *Sink, const void *Data, size_t Len, const TO_CON_OutputTag_t *Tag);
+void   TO_CON_OutputFlush(void);
+uint32 TO_CON_OutputOccupancy(const TO_CON_Sink_t *Sink);
+void   TO_CON_OutputTask(TO_CON_Sink_t *Sink);
+
+/*
+** Sink definitions indexed by TO_CON_SINK_*
+*/
+extern const TO_CON_SinkDef_t TO_CON_SinkDefs[TO_CON_SINK_COUNT];
+
+#endif
@@ -0,0 +1,212 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the TO Console flight recorder
+ *
+ *  The recorder file is mapped shared into memory once at startup.
+ *  Appending a record is a memcpy into the mapping and an update of the
+ *  write offset in the file header, with no system call, so the last
+ *  TO_CON_RECORDER_BYTES of telemetry are in the file even if the process
+ *  dies without flushing anything.  See to_con_recorder.h for the layout.
+ */
+
+#include <stdio.h>
+
+#include "cfe.h"
+
+#include "to_con_app.h"
+#include "to_con_recorder.h"
+#include "to_con_eventids.h"
+
+#if TO_CON_RECORDER_ENABLED
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/* Records start on four byte boundaries */
+#define TO_CON_RECORDER_ALIGN(Size) (((Size) + 3) & ~(size_t)3)
+
+#if TO_CON_RECORDER_ENABLED && (TO_CON_RECORDER_BYTES < 4096)
+#error TO_CON_RECORDER_BYTES is too small to be useful
+#endif
+
+#if TO_CON_RECORDER_ENABLED
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RecorderHasHeader() -- Check for a finished recording    */
+/*                                                                 */
+/* A missing or unreadable file counts as having no header.        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool TO_CON_RecorderHasHeader(const char *LocalPath)
+{
+    uint32 Magic = 0;
+    int    Fd;
+    bool   Found;
+
+    Fd = open(LocalPath, O_RDONLY);
+    if (Fd < 0)
+    {
+        return false;
+    }
+
+    Found = (read(Fd, &Magic, sizeof(Magic)) == (ssize_t)sizeof(Magic)) && (Magic == TO_CON_RECORDER_MAGIC);
+    close(Fd);
+
+    return Found;
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RecorderInit() -- Create and map the recorder file       */
+/*                                                                 */
+/* A recorder that cannot be set up is reported and left off; it   */
+/* does not stop TO_CON from starting.                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_RecorderInit(void)
+{
+#if TO_CON_RECORDER_ENABLED
+    TO_CON_Recorder_t *      Rec = &TO_CON_Global.Recorder;
+    TO_CON_RecorderHeader_t *Header;
+    char                     LocalPath[OS_MAX_LOCAL_PATH_LEN];
+    char                     PrevPath[OS_MAX_LOCAL_PATH_LEN + 8];
+    void *                   Map;
+    int32                    OsStatus;
+    int                      Fd;
+
+    memset(Rec, 0, sizeof(*Rec));
+
+    /* mmap needs the host path behind the OSAL virtual path */
+    OsStatus = OS_TranslatePath(TO_CON_RECORDER_PATH, LocalPath);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(TO_CON_RECORDER_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't translate recorder path %s status %i", __LINE__, TO_CON_RECORDER_PATH,
+                          (int)OsStatus);
+        return;
+    }
+
+    /*
+     * The previous run's recording is what a post-mortem needs, so never
+     * overwrite it.  A file without a header is from a run that died during
+     * init and holds nothing, so it is not allowed to replace the last good
+     * recording.
+     */
+    snprintf(PrevPath, sizeof(PrevPath), "%s.prev", LocalPath);
+    if (TO_CON_RecorderHasHeader(LocalPath) && rename(LocalPath, PrevPath) != 0)
+    {
+        CFE_EVS_SendEvent(TO_CON_RECORDER_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't keep previous recording %s errno %i", __LINE__, LocalPath, errno);
+    }
+
+    Fd = open(LocalPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (Fd < 0 || ftruncate(Fd, TO_CON_RECORDER_BYTES) != 0)
+    {
+        CFE_EVS_SendEvent(TO_CON_RECORDER_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Can't create recorder %s errno %i",
+                          __LINE__, LocalPath, errno);
+        if (Fd >= 0)
+        {
+            close(Fd);
+        }
+        return;
+    }
+
+    Map = mmap(NULL, TO_CON_RECORDER_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+    close(Fd);
+    if (Map == MAP_FAILED)
+    {
+        CFE_EVS_SendEvent(TO_CON_RECORDER_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Can't map recorder %s errno %i",
+                          __LINE__, LocalPath, errno);
+        return;
+    }
+
+    /* Touch every page now so appending never takes a page fault in the drain loop */
+    memset(Map, 0, TO_CON_RECORDER_BYTES);
+
+    Header             = Map;
+    Header->Magic      = TO_CON_RECORDER_MAGIC;
+    Header->Version    = TO_CON_RECORDER_VERSION;
+    Header->Content    = TO_CON_RECORDER_CONTENT;
+    Header->DataOffset = TO_CON_RECORDER_ALIGN(sizeof(TO_CON_RecorderHeader_t));
+    Header->DataSize   = (TO_CON_RECORDER_BYTES - Header->DataOffset) & ~(uint32)3;
+
+    Rec->Data   = (uint8 *)Map + Header->DataOffset;
+    Rec->Header = Header;
+
+    CFE_EVS_SendEvent(TO_CON_RECORDER_INF_EID, CFE_EVS_EventType_INFORMATION, "TO recording %s telemetry to %s, %u bytes",
+                      (TO_CON_RECORDER_CONTENT == TO_CON_RECORDER_RAW) ? "raw" : "encoded", TO_CON_RECORDER_PATH,
+                      (unsigned int)Header->DataSize);
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RecorderAppend() -- Add a record over the oldest ones    */
+/*                                                                 */
+/* The record is complete before WriteOffset moves past it, so     */
+/* after a crash the header never points beyond a torn record.     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_RecorderAppend(const void *Content, size_t Length)
+{
+    TO_CON_Recorder_t *      Rec    = &TO_CON_Global.Recorder;
+    TO_CON_RecorderHeader_t *Header = Rec->Header;
+    TO_CON_RecorderRecord_t  Record;
+    size_t                   Needed;
+    uint32                   Offset;
+
+    if (Header == NULL)
+    {
+        return;
+    }
+
+    Needed = sizeof(Record) + TO_CON_RECORDER_ALIGN(Length);
+    if (Needed > Header->DataSize)
+    {
+        return;
+    }
+
+    Offset = Header->WriteOffset;
+    if ((Offset + Needed) > Header->DataSize)
+    {
+        /* Mark the rest of the buffer unused and start over at the beginning */
+        if ((Header->DataSize - Offset) >= sizeof(Record))
+        {
+            Record.Sync   = TO_CON_RECORDER_SYNC;
+            Record.Length = 0;
+            memcpy(&Rec->Data[Offset], &Record, sizeof(Record));
+        }
+
+        Offset = 0;
+        __atomic_store_n(&Header->WrapCount, Header->WrapCount + 1, __ATOMIC_RELEASE);
+        __atomic_store_n(&Header->WriteOffset, Offset, __ATOMIC_RELEASE);
+    }
+
+    Record.Sync   = TO_CON_RECORDER_SYNC;
+    Record.Length = (uint32)Length;
+    memcpy(&Rec->Data[Offset + sizeof(Record)], Content, Length);
+    memcpy(&Rec->Data[Offset], &Record, sizeof(Record));
+
+    __atomic_store_n(&Header->WriteOffset, (uint32)(Offset + Needed), __ATOMIC_RELEASE);
+}
@@ -0,0 +1,124 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define TO Console flight recorder
+ *
+ * The recorder file starts with a TO_CON_RecorderHeader_t, followed by
+ * DataSize bytes used as a circular buffer of records.  Each record is a
+ * TO_CON_RecorderRecord_t and Length bytes of content, padded to a
+ * multiple of four.  A record never wraps: a record with a zero Length,
+ * or too little room left for a record header, means the rest of the
+ * buffer is unused and the next record is at offset zero.
+ *
+ * To read it back, start at the first record at or after WriteOffset
+ * (scan for TO_CON_RECORDER_SYNC) and read to the end of the buffer,
+ * then from offset zero up to WriteOffset.  If WrapCount is zero only
+ * the second part exists.
+ */
+
+#ifndef TO_CON_RECORDER_H
+#define TO_CON_RECORDER_H
+
+#include "common_types.h"
+#include "cfe.h"
+
+#include "to_con_platform_cfg.h"
+
+/************************************************************************
+** Macro Definitions
+*************************************************************************/
+
+#define TO_CON_RECORDER_MAGIC   0x544F4352 /**< "TOCR", first word of a recorder file */
+#define TO_CON_RECORDER_VERSION 1
+#define TO_CON_RECORDER_SYNC    0x52454331 /**< "REC1", first word of every record */
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * Recorder file header, in host byte order
+ */
+typedef struct
+{
+    uint32 Magic;       /**< TO_CON_RECORDER_MAGIC */
+    uint16 Version;     /**< TO_CON_RECORDER_VERSION */
+    uint16 Content;     /**< TO_CON_RECORDER_RAW or TO_CON_RECORDER_ENCODED */
+    uint32 DataOffset;  /**< Start of the circular buffer from the start of the file */
+    uint32 DataSize;    /**< Size of the circular buffer */
+    uint32 WriteOffset; /**< Where the next record goes, relative to DataOffset */
+    uint32 WrapCount;   /**< Times the buffer wrapped back to offset zero */
+} TO_CON_RecorderHeader_t;
+
+/**
+ * Header of each record in the circular buffer
+ */
+typedef struct
+{
+    uint32 Sync;   /**< TO_CON_RECORDER_SYNC */
+    uint32 Length; /**< Content bytes that follow, zero for the end of the used buffer */
+} TO_CON_RecorderRecord_t;
+
+/**
+ * Recorder state, only ever touched by the TO_CON main task
+ */
+typedef struct
+{
+    TO_CON_RecorderHeader_t *Header; /**< Start of the mapping, NULL if not recording */
+    uint8 *                  Data;
+} TO_CON_Recorder_t;
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+void TO_CON_RecorderInit(void);
+void TO_CON_RecorderAppend(const void *Content, size_t Length);
+
+/************************************************************************
+ * Inline Functions
+ ************************************************************************/
+
+/**
+ * Record a packet as it came off the telemetry pipe, if the recorder keeps raw packets
+ */
+static inline void TO_CON_RecorderRaw(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    CFE_MSG_Size_t MsgSize = 0;
+
+    if (TO_CON_RECORDER_ENABLED && TO_CON_RECORDER_CONTENT == TO_CON_RECORDER_RAW)
+    {
+        CFE_MSG_GetSize(&SBBufPtr->Msg, &MsgSize);
+        TO_CON_RecorderAppend(SBBufPtr, MsgSize);
+    }
+}
+
+/**
+ * Record an encoded packet, if the recorder keeps the encoded output
+ */
+static inline void TO_CON_RecorderEncoded(const void *Data, size_t Len)
+{
+    if (TO_CON_RECORDER_ENABLED && TO_CON_RECORDER_CONTENT == TO_CON_RECORDER_ENCODED)
+    {
+        TO_CON_RecorderAppend(Data, Len);
+    }
+}
+
+#endif
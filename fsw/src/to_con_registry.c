@@ -0,0 +1,268 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the TO Console decoder registry
+ */
+
+#include "cfe.h"
+
+#include "to_con_app.h"
+#include "to_con_registry.h"
+#include "to_con_eventids.h"
+
+#if ((TO_CON_DECODER_HASH_SIZE & (TO_CON_DECODER_HASH_SIZE - 1)) != 0)
+#error TO_CON_DECODER_HASH_SIZE must be a power of two
+#endif
+
+#if (TO_CON_DECODER_HASH_SIZE <= TO_CON_MAX_DECODERS)
+#error TO_CON_DECODER_HASH_SIZE must be larger than TO_CON_MAX_DECODERS
+#endif
+
+#define TO_CON_REGISTRY_MUTEX_NAME "TO_CON_REG_MUT"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RegistryHash() -- First bucket to probe for a MsgId      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint32 TO_CON_RegistryHash(CFE_SB_MsgId_t MsgId)
+{
+    /* Fibonacci hashing spreads the clustered cFE MsgId values over the table */
+    return ((CFE_SB_MsgIdToValue(MsgId) * 0x9E3779B1U) >> 16) & (TO_CON_DECODER_HASH_SIZE - 1);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RegistryInit() -- Create the registry and fill built-ins */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_RegistryInit(void)
+{
+    TO_CON_Registry_t *Reg = &TO_CON_Global.Registry;
+    int32              OsStatus;
+
+    memset(Reg, 0, sizeof(*Reg));
+
+    OsStatus = OS_MutSemCreate(&Reg->Mutex, TO_CON_REGISTRY_MUTEX_NAME, 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(TO_CON_DECODER_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't create registry mutex status %i", __LINE__, (int)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    return TO_CON_RegisterBuiltinDecoders();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RegistryLookup() -- Find the entry for a MsgId           */
+/*                                                                 */
+/* Called for every packet; lock free because published entries    */
+/* never change.                                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const TO_CON_DecoderEntry_t *TO_CON_RegistryLookup(CFE_SB_MsgId_t MsgId)
+{
+    TO_CON_Registry_t *          Reg = &TO_CON_Global.Registry;
+    const TO_CON_DecoderEntry_t *Entry;
+    uint32                       Bucket;
+    uint16                       Slot;
+
+    Bucket = TO_CON_RegistryHash(MsgId);
+
+    while (true)
+    {
+        Slot = __atomic_load_n(&Reg->Index[Bucket], __ATOMIC_ACQUIRE);
+        if (Slot == 0)
+        {
+            return NULL;
+        }
+
+        Entry = &Reg->Entries[Slot - 1];
+        if (CFE_SB_MsgId_Equal(Entry->MsgId, MsgId))
+        {
+            return Entry;
+        }
+
+        Bucket = (Bucket + 1) & (TO_CON_DECODER_HASH_SIZE - 1);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RegistryQuiescent() -- The main task holds no entries    */
+/*                                                                 */
+/* Called by the main task between drain passes, so that entries   */
+/* retired before now can be reused.                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_RegistryQuiescent(void)
+{
+    TO_CON_Registry_t *Reg = &TO_CON_Global.Registry;
+
+    /* Release: every lookup of the pass is complete before the epoch moves */
+    __atomic_store_n(&Reg->ReaderEpoch, Reg->ReaderEpoch + 1, __ATOMIC_RELEASE);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RegistryFreeSlot() -- Find an entry slot to publish into */
+/*                                                                 */
+/* Prefers a retired slot no reader can still hold.  Returns       */
+/* TO_CON_MAX_DECODERS if there is none.  Called with the mutex.   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 TO_CON_RegistryFreeSlot(void)
+{
+    TO_CON_Registry_t *Reg   = &TO_CON_Global.Registry;
+    uint32             Epoch = __atomic_load_n(&Reg->ReaderEpoch, __ATOMIC_ACQUIRE);
+    uint32             i;
+
+    for (i = 0; i < Reg->EntryCount; i++)
+    {
+        if (Reg->Retired[i] && (int32)(Epoch - Reg->RetiredEpoch[i]) > 0)
+        {
+            Reg->Retired[i] = false;
+            return i;
+        }
+    }
+
+    if (Reg->EntryCount < TO_CON_MAX_DECODERS)
+    {
+        return Reg->EntryCount++;
+    }
+
+    return TO_CON_MAX_DECODERS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RegistryAdd() -- Publish a new entry for a MsgId         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CFE_Status_t TO_CON_RegistryAdd(CFE_SB_MsgId_t MsgId, const char *Name, TO_CON_DecodeFunc_t DecodeFunc,
+                                       size_t ExpectedSize, const TO_CON_FieldLayout_t *Layout)
+{
+    TO_CON_Registry_t *    Reg = &TO_CON_Global.Registry;
+    TO_CON_DecoderEntry_t *Entry = NULL;
+    uint32                 Bucket;
+    uint32                 NewSlot;
+    uint16                 Slot;
+    CFE_Status_t           Status;
+
+    if (!CFE_SB_IsValidMsgId(MsgId) || Name == NULL || Name[0] == '\0')
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    if (!OS_ObjectIdDefined(Reg->Mutex))
+    {
+        return CFE_STATUS_INCORRECT_STATE;
+    }
+
+    OS_MutSemTake(Reg->Mutex);
+
+    /* Find the bucket already holding this MsgId, or the first empty one */
+    Bucket = TO_CON_RegistryHash(MsgId);
+    while (true)
+    {
+        Slot = Reg->Index[Bucket];
+        if (Slot == 0 || CFE_SB_MsgId_Equal(Reg->Entries[Slot - 1].MsgId, MsgId))
+        {
+            break;
+        }
+
+        Bucket = (Bucket + 1) & (TO_CON_DECODER_HASH_SIZE - 1);
+    }
+
+    /*
+     * Replacing an entry uses another slot, so a lookup running in the
+     * main task at the same time sees either the old or the new entry.
+     */
+    NewSlot = TO_CON_RegistryFreeSlot();
+    if (NewSlot >= TO_CON_MAX_DECODERS)
+    {
+        Status = CFE_STATUS_RANGE_ERROR;
+    }
+    else
+    {
+        Entry               = &Reg->Entries[NewSlot];
+        Entry->MsgId        = MsgId;
+        Entry->DecodeFunc   = DecodeFunc;
+        Entry->ExpectedSize = ExpectedSize;
+        Entry->Layout       = Layout;
+        strncpy(Entry->Name, Name, sizeof(Entry->Name) - 1);
+        Entry->Name[sizeof(Entry->Name) - 1] = '\0';
+
+        __atomic_store_n(&Reg->Index[Bucket], (uint16)(NewSlot + 1), __ATOMIC_RELEASE);
+
+        /* Lookups that found the old entry may still use it until the main task's pass ends */
+        if (Slot != 0)
+        {
+            Reg->Retired[Slot - 1]      = true;
+            Reg->RetiredEpoch[Slot - 1] = __atomic_load_n(&Reg->ReaderEpoch, __ATOMIC_ACQUIRE);
+        }
+
+        Status = CFE_SUCCESS;
+    }
+
+    OS_MutSemGive(Reg->Mutex);
+
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(TO_CON_DECODER_INF_EID, CFE_EVS_EventType_DEBUG, "TO registered decoder %s for MID 0x%x",
+                          Entry->Name, (unsigned int)CFE_SB_MsgIdToValue(MsgId));
+    }
+    else
+    {
+        CFE_EVS_SendEvent(TO_CON_DECODER_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO Can't register decoder for MID 0x%x, registry full", __LINE__,
+                          (unsigned int)CFE_SB_MsgIdToValue(MsgId));
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RegisterDecoder() -- Public registration API             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_RegisterDecoder(CFE_SB_MsgId_t MsgId, const char *Name, TO_CON_DecodeFunc_t DecodeFunc,
+                                    size_t ExpectedSize)
+{
+    return TO_CON_RegistryAdd(MsgId, Name, DecodeFunc, ExpectedSize, NULL);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_RegisterFieldDecoder() -- Public registration API        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_RegisterFieldDecoder(CFE_SB_MsgId_t MsgId, const char *Name, const TO_CON_FieldLayout_t *Layout)
+{
+    if (Layout == NULL || Layout->Fields == NULL || !TO_CON_ValidateFieldLayout(Layout))
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    return TO_CON_RegistryAdd(MsgId, Name, NULL, 0, Layout);
+}
@@ -0,0 +1,88 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define TO Console decoder registry
+ */
+
+#ifndef TO_CON_REGISTRY_H
+#define TO_CON_REGISTRY_H
+
+#include "common_types.h"
+#include "osapi.h"
+#include "cfe.h"
+
+#include "to_con_platform_cfg.h"
+#include "to_con_decoder.h"
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * One registered telemetry stream
+ */
+typedef struct
+{
+    CFE_SB_MsgId_t              MsgId;
+    TO_CON_DecodeFunc_t         DecodeFunc;
+    size_t                      ExpectedSize;
+    const TO_CON_FieldLayout_t *Layout; /**< Fields to print when there is no DecodeFunc */
+    char                        Name[TO_CON_DECODER_NAME_LEN];
+} TO_CON_DecoderEntry_t;
+
+/**
+ * Decoder registry
+ *
+ * Entries are never modified while published.  The hash index holds entry
+ * number + 1 (0 is an empty bucket) and is probed linearly, so a lookup
+ * costs the same no matter how many streams are registered.
+ *
+ * Replacing a MsgId publishes a new entry and retires the old one.  The
+ * main task, the only reader, bumps ReaderEpoch after every drain pass;
+ * a retired entry is reused once ReaderEpoch has moved past the value it
+ * was retired at, as no lookup can still be using it by then.
+ */
+typedef struct
+{
+    osal_id_t Mutex;
+    uint32    EntryCount; /**< Slots ever used, in use or retired */
+    uint32    ReaderEpoch;
+
+    uint16                Index[TO_CON_DECODER_HASH_SIZE];
+    TO_CON_DecoderEntry_t Entries[TO_CON_MAX_DECODERS];
+    bool                  Retired[TO_CON_MAX_DECODERS];
+    uint32                RetiredEpoch[TO_CON_MAX_DECODERS];
+} TO_CON_Registry_t;
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+CFE_Status_t                 TO_CON_RegistryInit(void);
+const TO_CON_DecoderEntry_t *TO_CON_RegistryLookup(CFE_SB_MsgId_t MsgId);
+void                         TO_CON_RegistryQuiescent(void);
+CFE_Status_t                 TO_CON_RegisterBuiltinDecoders(void);
+bool                         TO_CON_ValidateFieldLayout(const TO_CON_FieldLayout_t *Layout);
+size_t                       TO_CON_RenderFields(const TO_CON_FieldLayout_t *Layout, const CFE_SB_Buffer_t *SourceBuffer,
+                                                 char *TextBuf, size_t TextBufSize);
+size_t                       TO_CON_RenderFieldsJson(const TO_CON_FieldLayout_t *Layout,
+                                                     const CFE_SB_Buffer_t *SourceBuffer, char *Dest, size_t DestSize);
+
+#endif
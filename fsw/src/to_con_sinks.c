@@ -0,0 +1,210 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the TO Console output sink definitions
+ *
+ *  Each sink is a set of hooks run by its own writer task, see
+ *  TO_CON_OutputTask().
+ */
+
+#include <stdio.h>
+
+#include "cfe.h"
+
+#include "to_con_app.h"
+#include "to_con_output.h"
+#include "to_con_file.h"
+#include "to_con_latency.h"
+#include "to_con_perfids.h"
+#include "to_con_udp.h"
+
+#if (TO_CON_CONSOLE_STDIO == 0) && (TO_CON_DEFAULT_ENCODER_MODE == TO_CON_ENCODER_BINARY)
+#error TO_CON_ENCODER_BINARY console output needs TO_CON_CONSOLE_STDIO
+#endif
+
+#if (TO_CON_CONSOLE_STDIO != 0)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_ConsolePut() -- Write text to stdout in one call         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_ConsolePut(const char *Data, size_t Len)
+{
+    fwrite(Data, 1, Len, stdout);
+    fflush(stdout);
+}
+
+#else
+
+/* Longest text one OS_printf call writes without truncating it */
+#define TO_CON_CONSOLE_CHUNK_BYTES (OS_BUFFER_SIZE - 1)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_ConsolePut() -- Write text to the OSAL console           */
+/*                                                                 */
+/* Each OS_printf call takes as many whole lines as fit; a line    */
+/* longer than that is split.                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_ConsolePut(const char *Data, size_t Len)
+{
+    size_t Chunk;
+    size_t LineChunk;
+
+    while (Len > 0)
+    {
+        Chunk = Len;
+        if (Chunk > TO_CON_CONSOLE_CHUNK_BYTES)
+        {
+            Chunk = TO_CON_CONSOLE_CHUNK_BYTES;
+
+            LineChunk = Chunk;
+            while (LineChunk > 0 && Data[LineChunk - 1] != '\n')
+            {
+                --LineChunk;
+            }
+            if (LineChunk > 0)
+            {
+                Chunk = LineChunk;
+            }
+        }
+
+        OS_printf("%.*s", (int)Chunk, Data);
+
+        Data += Chunk;
+        Len -= Chunk;
+    }
+}
+
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_ConsoleWrite() -- Write one batch to the console         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_ConsoleWrite(const TO_CON_OutputSlot_t *Slot, int64 NowMillis)
+{
+    int64  WriteMillis;
+    uint32 i;
+
+    (void)NowMillis;
+
+    TO_CON_ConsolePut(Slot->Data, Slot->Len);
+
+    /* One clock read per batch; every line in it reached the console together */
+    WriteMillis = TO_CON_TimeToMillis(CFE_TIME_GetTime());
+    TO_CON_LatencyApplyResets();
+    for (i = 0; i < Slot->Packets; i++)
+    {
+        TO_CON_LatencyRecord(Slot->Tags[i].StreamSlot, WriteMillis - Slot->Tags[i].SourceMillis);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_FileSinkWrite() -- Add one batch to the log file         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_FileSinkWrite(const TO_CON_OutputSlot_t *Slot, int64 NowMillis)
+{
+    /* Usually only a copy into the write-behind buffer */
+    TO_CON_FileWrite(Slot->Data, Slot->Len, NowMillis);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_UdpSinkWrite() -- Send one batch as datagrams            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_UdpSinkWrite(const TO_CON_OutputSlot_t *Slot, int64 NowMillis)
+{
+    (void)NowMillis;
+
+    TO_CON_UdpSend(Slot->Data, Slot->Lengths, Slot->Packets);
+}
+
+/*
+** Writer task entry points, one per sink
+*/
+static void TO_CON_ConsoleTask(void)
+{
+    TO_CON_OutputTask(&TO_CON_Global.Output.Sinks[TO_CON_SINK_CONSOLE]);
+}
+
+static void TO_CON_FileTask(void)
+{
+    TO_CON_OutputTask(&TO_CON_Global.Output.Sinks[TO_CON_SINK_FILE]);
+}
+
+static void TO_CON_UdpTask(void)
+{
+    TO_CON_OutputTask(&TO_CON_Global.Output.Sinks[TO_CON_SINK_UDP]);
+}
+
+static void TO_CON_NullTask(void)
+{
+    TO_CON_OutputTask(&TO_CON_Global.Output.Sinks[TO_CON_SINK_NULL]);
+}
+
+/*
+** Sink definitions, indexed by TO_CON_SINK_*
+*/
+const TO_CON_SinkDef_t TO_CON_SinkDefs[TO_CON_SINK_COUNT] = {
+    [TO_CON_SINK_CONSOLE] = {.Name               = "console",
+                             .TaskName           = "TO_CON_WR_CON",
+                             .SemName            = "TO_CON_WR_CON_SEM",
+                             .TaskEntry          = TO_CON_ConsoleTask,
+                             .Available          = true,
+                             .StartEnabled       = true,
+                             .DefaultEncoderMode = TO_CON_DEFAULT_ENCODER_MODE,
+                             .PerfId             = TO_CON_CONSOLE_WRITE_PERF_ID,
+                             .Write              = TO_CON_ConsoleWrite},
+    [TO_CON_SINK_FILE]    = {.Name               = "file",
+                             .TaskName           = "TO_CON_WR_FILE",
+                             .SemName            = "TO_CON_WR_FILE_SEM",
+                             .TaskEntry          = TO_CON_FileTask,
+                             .Available          = (TO_CON_FILE_SINK_ENABLED != 0),
+                             .StartEnabled       = true,
+                             .DefaultEncoderMode = TO_CON_FILE_ENCODER_MODE,
+                             .PerfId             = TO_CON_FILE_WRITE_PERF_ID,
+                             .Start              = TO_CON_FileOpen,
+                             .Write              = TO_CON_FileSinkWrite,
+                             .Poll               = TO_CON_FilePoll,
+                             .Stop               = TO_CON_FileClose},
+    [TO_CON_SINK_UDP]     = {.Name               = "udp",
+                             .TaskName           = "TO_CON_WR_UDP",
+                             .SemName            = "TO_CON_WR_UDP_SEM",
+                             .TaskEntry          = TO_CON_UdpTask,
+                             .Available          = true,
+                             .StartEnabled       = false, /* Until TO_CON_ENABLE_OUTPUT_CC */
+                             .DefaultEncoderMode = TO_CON_UDP_ENCODER_MODE,
+                             .PerfId             = TO_CON_UDP_WRITE_PERF_ID,
+                             .Write              = TO_CON_UdpSinkWrite},
+    [TO_CON_SINK_NULL]    = {.Name               = "null",
+                             .TaskName           = "TO_CON_WR_NULL",
+                             .SemName            = "TO_CON_WR_NULL_SEM",
+                             .TaskEntry          = TO_CON_NullTask,
+                             .Available          = (TO_CON_NULL_SINK_ENABLED != 0),
+                             .StartEnabled       = true,
+                             .DefaultEncoderMode = TO_CON_DEFAULT_ENCODER_MODE},
+};
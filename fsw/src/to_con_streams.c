@@ -0,0 +1,618 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the TO Console active subscription set
+ *
+ *  Every stream subscribed on a telemetry pipe, whether it came from the
+ *  subscription table or from a ground command, occupies one slot of
+ *  TO_CON_Global.Streams.  A stream is subscribed on the pipe of the
+ *  priority lane its QoS Priority names.  Only the TO_CON main task
+ *  touches this set.
+ */
+
+#include "cfe.h"
+
+#include "to_con_app.h"
+#include "to_con_streams.h"
+#include "to_con_eventids.h"
+
+#if ((TO_CON_STREAM_HASH_SIZE & (TO_CON_STREAM_HASH_SIZE - 1)) != 0)
+#error TO_CON_STREAM_HASH_SIZE must be a power of two
+#endif
+
+#if (TO_CON_STREAM_HASH_SIZE <= TO_CON_MAX_SUBSCRIPTIONS) || (TO_CON_MAX_SUBSCRIPTIONS > 255)
+#error TO_CON_STREAM_HASH_SIZE must be larger than TO_CON_MAX_SUBSCRIPTIONS, which must fit in a uint8
+#endif
+
+#if (TO_CON_TLM_PRIORITY_LEVELS < 1) || (TO_CON_TLM_PRIORITY_LEVELS > 255)
+#error TO_CON_TLM_PRIORITY_LEVELS must be between 1 and 255
+#endif
+
+/* The CCSDS sequence count is 14 bits */
+#define TO_CON_SEQCNT_MASK 0x3FFF
+
+/* Telemetry pipe of the priority lane a stream's QoS puts it in */
+#define TO_CON_STREAM_PIPE(Flags) (TO_CON_Global.Tlm_pipe[(Flags).Priority])
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamHash() -- First bucket to probe for a MsgId        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint32 TO_CON_StreamHash(CFE_SB_MsgId_t MsgId)
+{
+    return ((CFE_SB_MsgIdToValue(MsgId) * 0x9E3779B1U) >> 16) & (TO_CON_STREAM_HASH_SIZE - 1);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamIndexRebuild() -- Rehash every active slot         */
+/*                                                                 */
+/* Subscriptions change rarely, so rebuilding is simpler than      */
+/* supporting deletes in an open-addressed table.  Also finds the  */
+/* range of lanes in use, for the telemetry wait.                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_StreamIndexRebuild(void)
+{
+    TO_CON_StreamIndex_t *Index = &TO_CON_Global.StreamIndex;
+    uint32                Bucket;
+    uint8                 Lane;
+    bool                  LaneFound = false;
+    int32                 i;
+
+    memset(Index, 0, sizeof(*Index));
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        if (!TO_CON_Global.Streams[i].InUse)
+        {
+            continue;
+        }
+
+        Lane = TO_CON_Global.Streams[i].Flags.Priority;
+        if (!LaneFound || Lane < Index->WaitLane)
+        {
+            Index->WaitLane = Lane;
+        }
+        if (!LaneFound || Lane > Index->TopLane)
+        {
+            Index->TopLane = Lane;
+        }
+        LaneFound = true;
+
+        Bucket = TO_CON_StreamHash(TO_CON_Global.Streams[i].Stream);
+        while (Index->Buckets[Bucket] != 0)
+        {
+            Bucket = (Bucket + 1) & (TO_CON_STREAM_HASH_SIZE - 1);
+        }
+
+        Index->Buckets[Bucket] = (uint8)(i + 1);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamLookup() -- Active stream for a MsgId, or NULL     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+TO_CON_Stream_t *TO_CON_StreamLookup(CFE_SB_MsgId_t MsgId)
+{
+    TO_CON_StreamIndex_t *Index = &TO_CON_Global.StreamIndex;
+    TO_CON_Stream_t *     Entry;
+    uint32                Bucket;
+
+    Bucket = TO_CON_StreamHash(MsgId);
+    while (Index->Buckets[Bucket] != 0)
+    {
+        Entry = &TO_CON_Global.Streams[Index->Buckets[Bucket] - 1];
+        if (CFE_SB_MsgId_Equal(Entry->Stream, MsgId))
+        {
+            return Entry;
+        }
+
+        Bucket = (Bucket + 1) & (TO_CON_STREAM_HASH_SIZE - 1);
+    }
+
+    return NULL;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamAdmit() -- Apply a stream's output controls        */
+/*                                                                 */
+/* Returns false if the packet should be suppressed.  NowMillis is */
+/* read once per drain pass, not per packet.                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool TO_CON_StreamAdmit(TO_CON_Stream_t *Entry, int64 NowMillis)
+{
+    int64 Elapsed;
+
+    if (Entry->Decimation > 1)
+    {
+        if (Entry->DecimationCount != 0)
+        {
+            if (++Entry->DecimationCount >= Entry->Decimation)
+            {
+                Entry->DecimationCount = 0;
+            }
+            return false;
+        }
+
+        Entry->DecimationCount = 1;
+    }
+
+    if (Entry->MinIntervalMsec != 0 && Entry->LastOutputMillis != 0 &&
+        (NowMillis - Entry->LastOutputMillis) < Entry->MinIntervalMsec)
+    {
+        return false;
+    }
+
+    if (Entry->ByteBudget != 0)
+    {
+        /* Refill at ByteBudget bytes per second, up to one second's worth */
+        Elapsed = NowMillis - Entry->LastRefillMillis;
+        if (Elapsed > 0)
+        {
+            Entry->Tokens += (Elapsed * Entry->ByteBudget) / 1000;
+            if (Entry->Tokens > Entry->ByteBudget)
+            {
+                Entry->Tokens = Entry->ByteBudget;
+            }
+            Entry->LastRefillMillis = NowMillis;
+        }
+
+        /* The cost of a packet is only known after encoding, so a stream may overdraw once */
+        if (Entry->Tokens <= 0)
+        {
+            return false;
+        }
+    }
+
+    Entry->LastOutputMillis = NowMillis;
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_PayloadHash() -- Hash a packet, skipping its header      */
+/*                                                                 */
+/* Eight bytes per multiply.  The header holds the time and        */
+/* sequence count, which differ on every packet; the length is     */
+/* mixed in so a resized payload always counts as a change.        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint64 TO_CON_PayloadHash(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    const uint8 *  Payload = (const uint8 *)SBBufPtr + sizeof(CFE_MSG_TelemetryHeader_t);
+    CFE_MSG_Size_t MsgSize = 0;
+    size_t         Remaining;
+    uint64         Hash;
+    uint64         Word;
+
+    CFE_MSG_GetSize(&SBBufPtr->Msg, &MsgSize);
+    if (MsgSize <= sizeof(CFE_MSG_TelemetryHeader_t))
+    {
+        return MsgSize;
+    }
+
+    Remaining = MsgSize - sizeof(CFE_MSG_TelemetryHeader_t);
+    Hash      = 0xCBF29CE484222325ULL ^ Remaining;
+
+    while (Remaining >= sizeof(Word))
+    {
+        memcpy(&Word, Payload, sizeof(Word));
+        Hash = (Hash ^ Word) * 0x9E3779B97F4A7C15ULL;
+        Hash ^= Hash >> 29;
+        Payload += sizeof(Word);
+        Remaining -= sizeof(Word);
+    }
+
+    if (Remaining != 0)
+    {
+        Word = 0;
+        memcpy(&Word, Payload, Remaining);
+        Hash = (Hash ^ Word) * 0x9E3779B97F4A7C15ULL;
+        Hash ^= Hash >> 29;
+    }
+
+    return Hash;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamUnchanged() -- Apply a stream's emit on change     */
+/*                                                                 */
+/* Returns true if the packet repeats the payload last output and  */
+/* no keyframe is due, so it should be suppressed.  Checked before */
+/* the other output controls so repeats do not use up their        */
+/* allowance.  The reference payload only moves when a packet      */
+/* reaches the output, see TO_CON_StreamEmitted().                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool TO_CON_StreamUnchanged(TO_CON_Stream_t *Entry, const CFE_SB_Buffer_t *SBBufPtr, int64 NowMillis)
+{
+    if (Entry->KeyframeSec == 0)
+    {
+        return false;
+    }
+
+    Entry->PendingHash = TO_CON_PayloadHash(SBBufPtr);
+
+    return Entry->HashValid && Entry->PendingHash == Entry->EmittedHash &&
+           (NowMillis - Entry->LastOutputMillis) < ((int64)Entry->KeyframeSec * 1000);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamApplyControls() -- Copy output controls from table */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void TO_CON_StreamApplyControls(TO_CON_Stream_t *Entry, const TO_CON_Sub_t *SubEntry)
+{
+    if (Entry->ByteBudget != SubEntry->ByteBudget)
+    {
+        /* Start a new budget with a full bucket */
+        Entry->Tokens = SubEntry->ByteBudget;
+    }
+
+    Entry->Decimation      = SubEntry->Decimation;
+    Entry->MinIntervalMsec = SubEntry->MinIntervalMsec;
+    Entry->ByteBudget      = SubEntry->ByteBudget;
+    Entry->DumpBytes       = SubEntry->DumpBytes;
+    Entry->KeyframeSec     = SubEntry->KeyframeSec;
+    Entry->SinkMask        = (SubEntry->SinkMask != 0) ? SubEntry->SinkMask : TO_CON_DEFAULT_SINK_MASK;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamFind() -- Slot subscribed to Stream, or -1         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 TO_CON_StreamFind(CFE_SB_MsgId_t Stream)
+{
+    int32 i;
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        if (TO_CON_Global.Streams[i].InUse && CFE_SB_MsgId_Equal(TO_CON_Global.Streams[i].Stream, Stream))
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamTrackSequence() -- Count packets lost upstream     */
+/*                                                                 */
+/* A jump in the CCSDS sequence count means SB dropped packets     */
+/* before they reached the pipe, e.g. because the pipe was full or */
+/* the stream's BufLimit was exceeded.  The count is 14 bits and   */
+/* wraps.  A jump of more than half the range is taken as a        */
+/* repeated packet or a restarted sender, not as a loss.           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_StreamTrackSequence(TO_CON_Stream_t *Entry, const CFE_SB_Buffer_t *SBBufPtr)
+{
+    CFE_MSG_SequenceCount_t Seq = 0;
+    uint16                  Gap;
+    TO_CON_StreamStats_t *  Stats;
+
+    CFE_MSG_GetSequenceCount(&SBBufPtr->Msg, &Seq);
+
+    if (!Entry->SeqValid)
+    {
+        Entry->SeqValid = true;
+        Entry->LastSeq  = Seq;
+        return;
+    }
+
+    Gap            = (uint16)((Seq - Entry->LastSeq - 1) & TO_CON_SEQCNT_MASK);
+    Entry->LastSeq = Seq;
+
+    if (Gap == 0 || Gap > (TO_CON_SEQCNT_MASK / 2))
+    {
+        return;
+    }
+
+    Stats = TO_CON_StreamStats(Entry);
+    Stats->PacketsLost += Gap;
+    TO_CON_Global.HkTlm.Payload.PacketsLost += Gap;
+
+    Entry->LostSinceEvent += Gap;
+    if (Entry->LostSinceEvent >= TO_CON_SEQ_LOSS_EVENT_THRESHOLD)
+    {
+        CFE_EVS_SendEvent(TO_CON_SEQ_LOSS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "TO lost %u packets of MID 0x%x upstream, %u in total; check pipe depth and BufLimit",
+                          (unsigned int)Entry->LostSinceEvent, (unsigned int)CFE_SB_MsgIdToValue(Entry->Stream),
+                          (unsigned int)Stats->PacketsLost);
+        Entry->LostSinceEvent = 0;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamSubscribe() -- Subscribe and record a stream       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_StreamSubscribe(CFE_SB_MsgId_t Stream, CFE_SB_Qos_t Flags, uint16 BufLimit)
+{
+    TO_CON_Stream_t *Entry;
+    CFE_Status_t     status;
+    int32            i;
+
+    if (Flags.Priority >= TO_CON_TLM_PRIORITY_LEVELS)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    if (TO_CON_StreamFind(Stream) >= 0)
+    {
+        return CFE_STATUS_INCORRECT_STATE;
+    }
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        if (!TO_CON_Global.Streams[i].InUse)
+        {
+            break;
+        }
+    }
+
+    if (i >= TO_CON_MAX_SUBSCRIPTIONS)
+    {
+        return CFE_STATUS_RANGE_ERROR;
+    }
+
+    status = CFE_SB_SubscribeEx(Stream, TO_CON_STREAM_PIPE(Flags), Flags, BufLimit);
+    if (status != CFE_SUCCESS)
+    {
+        return status;
+    }
+
+    Entry = &TO_CON_Global.Streams[i];
+    memset(Entry, 0, sizeof(*Entry));
+    Entry->InUse    = true;
+    Entry->Stream   = Stream;
+    Entry->Flags    = Flags;
+    Entry->BufLimit = BufLimit;
+
+    Entry->DumpBytes   = TO_CON_DEFAULT_DUMP_BYTES;
+    Entry->KeyframeSec = TO_CON_DEFAULT_KEYFRAME_SEC;
+    Entry->SinkMask    = TO_CON_DEFAULT_SINK_MASK;
+
+    /* A reused slot starts its statistics over */
+    memset(TO_CON_StreamStats(Entry), 0, sizeof(TO_CON_StreamStats_t));
+    TO_CON_StreamStats(Entry)->Stream = Stream;
+    TO_CON_LatencyResetStream((uint16)i);
+
+    TO_CON_StreamIndexRebuild();
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamUnsubscribe() -- Unsubscribe and forget a stream   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_StreamUnsubscribe(CFE_SB_MsgId_t Stream)
+{
+    CFE_Status_t status;
+    int32        Slot;
+
+    Slot = TO_CON_StreamFind(Stream);
+    if (Slot < 0)
+    {
+        return CFE_STATUS_INCORRECT_STATE;
+    }
+
+    status = CFE_SB_Unsubscribe(Stream, TO_CON_STREAM_PIPE(TO_CON_Global.Streams[Slot].Flags));
+    if (status == CFE_SUCCESS)
+    {
+        TO_CON_Global.Streams[Slot].InUse = false;
+        TO_CON_StreamIndexRebuild();
+    }
+
+    return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamUnsubscribeAll() -- Drop every telemetry stream    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_StreamUnsubscribeAll(void)
+{
+    TO_CON_Stream_t *Entry;
+    CFE_Status_t     status;
+    int32            i;
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        Entry = &TO_CON_Global.Streams[i];
+        if (!Entry->InUse)
+        {
+            continue;
+        }
+
+        status = CFE_SB_Unsubscribe(Entry->Stream, TO_CON_STREAM_PIPE(Entry->Flags));
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(TO_CON_REMOVEALLPTKS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO Can't Unsubscribe to stream 0x%x status %i", __LINE__,
+                              (unsigned int)CFE_SB_MsgIdToValue(Entry->Stream), (int)status);
+        }
+
+        Entry->InUse = false;
+    }
+
+    TO_CON_StreamIndexRebuild();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamResubscribe() -- Apply new QoS/BufLimit to a slot  */
+/*                                                                 */
+/* SB cannot change the limits of an existing subscription, so     */
+/* this unsubscribes and subscribes again, on the pipe of the new  */
+/* priority lane.  Packets already in a pipe are kept, but any     */
+/* published between the unsubscribe and the subscribe are lost.   */
+/*                                                                 */
+/* If the new subscription fails the old one is restored, so the   */
+/* slot is only freed when the stream can't be subscribed at all.  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static CFE_Status_t TO_CON_StreamResubscribe(TO_CON_Stream_t *Entry, CFE_SB_Qos_t Flags, uint16 BufLimit)
+{
+    CFE_Status_t status;
+
+    if (Flags.Priority >= TO_CON_TLM_PRIORITY_LEVELS)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    status = CFE_SB_Unsubscribe(Entry->Stream, TO_CON_STREAM_PIPE(Entry->Flags));
+    if (status != CFE_SUCCESS)
+    {
+        /* Still subscribed with the old settings */
+        return status;
+    }
+
+    status = CFE_SB_SubscribeEx(Entry->Stream, TO_CON_STREAM_PIPE(Flags), Flags, BufLimit);
+    if (status != CFE_SUCCESS)
+    {
+        if (CFE_SB_SubscribeEx(Entry->Stream, TO_CON_STREAM_PIPE(Entry->Flags), Entry->Flags, Entry->BufLimit) !=
+            CFE_SUCCESS)
+        {
+            Entry->InUse = false;
+            TO_CON_StreamIndexRebuild();
+        }
+        return status;
+    }
+
+    Entry->Flags    = Flags;
+    Entry->BufLimit = BufLimit;
+    TO_CON_StreamIndexRebuild();
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_StreamReconcile() -- Make the active set match a table   */
+/*                                                                 */
+/* Only streams that differ are touched, so a table swap does not  */
+/* interrupt output for the streams it leaves unchanged.  Streams  */
+/* added by ground command and absent from the table are kept.     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_StreamReconcile(const TO_CON_Subs_t *SubsTbl)
+{
+    const TO_CON_Sub_t *SubEntry;
+    TO_CON_Stream_t *   Entry;
+    bool                InTable[TO_CON_MAX_SUBSCRIPTIONS];
+    uint32              Added   = 0;
+    uint32              Removed = 0;
+    uint32              Changed = 0;
+    CFE_Status_t        status;
+    int32               Slot;
+    int32               i;
+
+    memset(InTable, 0, sizeof(InTable));
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        SubEntry = &SubsTbl->Subs[i];
+        if (!CFE_SB_IsValidMsgId(SubEntry->Stream))
+        {
+            /* Only process until invalid MsgId is found*/
+            break;
+        }
+
+        Slot = TO_CON_StreamFind(SubEntry->Stream);
+        if (Slot < 0)
+        {
+            status = TO_CON_StreamSubscribe(SubEntry->Stream, SubEntry->Flags, SubEntry->BufLimit);
+            if (status == CFE_SUCCESS)
+            {
+                Slot = TO_CON_StreamFind(SubEntry->Stream);
+                ++Added;
+            }
+        }
+        else
+        {
+            Entry  = &TO_CON_Global.Streams[Slot];
+            status = CFE_SUCCESS;
+
+            if (Entry->BufLimit != SubEntry->BufLimit || Entry->Flags.Priority != SubEntry->Flags.Priority ||
+                Entry->Flags.Reliability != SubEntry->Flags.Reliability)
+            {
+                status = TO_CON_StreamResubscribe(Entry, SubEntry->Flags, SubEntry->BufLimit);
+                ++Changed;
+            }
+        }
+
+        if (status != CFE_SUCCESS && Slot >= 0 && TO_CON_Global.Streams[Slot].InUse)
+        {
+            CFE_EVS_SendEvent(TO_CON_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO Can't change stream 0x%x, previous settings kept, status %i", __LINE__,
+                              (unsigned int)CFE_SB_MsgIdToValue(SubEntry->Stream), (int)status);
+            InTable[Slot] = true;
+            continue;
+        }
+
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(TO_CON_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "L%d TO Can't subscribe to stream 0x%x status %i", __LINE__,
+                              (unsigned int)CFE_SB_MsgIdToValue(SubEntry->Stream), (int)status);
+            continue;
+        }
+
+        TO_CON_StreamApplyControls(&TO_CON_Global.Streams[Slot], SubEntry);
+        TO_CON_Global.Streams[Slot].FromTable = true;
+        InTable[Slot]                         = true;
+    }
+
+    for (i = 0; i < TO_CON_MAX_SUBSCRIPTIONS; i++)
+    {
+        Entry = &TO_CON_Global.Streams[i];
+        if (Entry->InUse && Entry->FromTable && !InTable[i])
+        {
+            status = TO_CON_StreamUnsubscribe(Entry->Stream);
+            if (status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(TO_CON_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "L%d TO Can't Unsubscribe to stream 0x%x status %i", __LINE__,
+                                  (unsigned int)CFE_SB_MsgIdToValue(Entry->Stream), (int)status);
+            }
+            ++Removed;
+        }
+    }
+
+    CFE_EVS_SendEvent(TO_CON_TBL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "TO subscriptions updated: %u added, %u removed, %u changed", (unsigned int)Added,
+                      (unsigned int)Removed, (unsigned int)Changed);
+}
@@ -0,0 +1,119 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define TO Console active subscription set
+ */
+
+#ifndef TO_CON_STREAMS_H
+#define TO_CON_STREAMS_H
+
+#include "common_types.h"
+#include "cfe.h"
+
+#include "to_con_platform_cfg.h"
+#include "to_con_tbl.h"
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * One stream TO_CON is currently subscribed to
+ */
+typedef struct
+{
+    bool           InUse;
+    bool           FromTable; /**< Owned by the subscription table rather than a command */
+    CFE_SB_MsgId_t Stream;
+    CFE_SB_Qos_t   Flags;
+    uint16         BufLimit;
+
+    /* Output controls, copied from the table entry */
+    uint16 Decimation;
+    uint16 MinIntervalMsec;
+    uint32 ByteBudget;
+    uint16 DumpBytes;
+    uint16 KeyframeSec;
+    uint8  SinkMask; /**< Output sinks, bit (1 << TO_CON_SINK_*) for each */
+
+    /* Output control state */
+    uint16 DecimationCount;
+    int64  LastOutputMillis;
+    int64  LastRefillMillis;
+    int64  Tokens;
+    bool   HashValid;   /**< EmittedHash holds the payload hash of an output packet */
+    uint64 PendingHash; /**< Payload hash of the packet being forwarded */
+    uint64 EmittedHash;
+
+    /* CCSDS sequence tracking */
+    bool   SeqValid; /**< LastSeq holds the count of a packet seen on this stream */
+    uint16 LastSeq;
+    uint32 LostSinceEvent; /**< Losses not yet reported with TO_CON_SEQ_LOSS_ERR_EID */
+} TO_CON_Stream_t;
+
+/**
+ * MsgId to slot index, rebuilt whenever the active set changes
+ *
+ * Holds slot number + 1 (0 is an empty bucket), probed linearly.
+ */
+typedef struct
+{
+    uint8 Buckets[TO_CON_STREAM_HASH_SIZE];
+    uint8 WaitLane; /**< Least urgent priority lane with a subscription, pended on */
+    uint8 TopLane;  /**< Most urgent priority lane with a subscription */
+} TO_CON_StreamIndex_t;
+
+/************************************************************************
+ * Inline Functions
+ ************************************************************************/
+
+/**
+ * Account for a packet of a stream that reached the output
+ *
+ * Charges its bytes against the byte budget and makes its payload the
+ * reference for emit on change.
+ */
+static inline void TO_CON_StreamEmitted(TO_CON_Stream_t *Entry, size_t Bytes)
+{
+    if (Entry->ByteBudget != 0)
+    {
+        Entry->Tokens -= (int64)Bytes;
+    }
+
+    Entry->EmittedHash = Entry->PendingHash;
+    Entry->HashValid   = (Entry->KeyframeSec != 0);
+}
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+CFE_Status_t TO_CON_StreamSubscribe(CFE_SB_MsgId_t Stream, CFE_SB_Qos_t Flags, uint16 BufLimit);
+CFE_Status_t TO_CON_StreamUnsubscribe(CFE_SB_MsgId_t Stream);
+void         TO_CON_StreamUnsubscribeAll(void);
+void         TO_CON_StreamReconcile(const TO_CON_Subs_t *SubsTbl);
+
+TO_CON_Stream_t *TO_CON_StreamLookup(CFE_SB_MsgId_t MsgId);
+bool             TO_CON_StreamAdmit(TO_CON_Stream_t *Entry, int64 NowMillis);
+bool             TO_CON_StreamUnchanged(TO_CON_Stream_t *Entry, const CFE_SB_Buffer_t *SBBufPtr, int64 NowMillis);
+void             TO_CON_StreamTrackSequence(TO_CON_Stream_t *Entry, const CFE_SB_Buffer_t *SBBufPtr);
+int32        TO_CON_StreamFind(CFE_SB_MsgId_t Stream);
+
+#endif
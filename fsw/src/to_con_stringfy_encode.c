@@ -28,198 +28,161 @@
 #include "to_con_app.h"
 #include "to_con_eventids.h"
 #include "to_con_encode.h"
+#include "to_con_registry.h"
 
+/* "<time> <msgid> <name> " */
+#define MAX_TO_TEXT_PREFIX_BYTES 64
 
+/* Decoded content; the field decoder's cFE housekeeping lines are the longest */
+#define MAX_TO_MSG_TEXT_BYTES 1536
 
-//#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
-//#include "cfe_sb_api_typedefs.h"
-//#include "to_con_tbl.h"
-#include "cfe_msgids.h"
+/* "len=NNNNN " ahead of the dumped digits */
+#define MAX_TO_DUMP_PREFIX_BYTES 11
+#define MAX_TO_DUMP_TEXT_BYTES   (MAX_TO_DUMP_PREFIX_BYTES + (2 * TO_CON_MAX_DUMP_BYTES))
 
 /*
-** Add the proper include file for the message IDs below
-*/
-#include "to_con_msgids.h"
-
-#ifdef HAVE_MXM_APP
-#include "mxm_app_msgids.h"
-#include "mxm_app_msgstruct.h"
-#endif
-
-#ifdef HAVE_HUFF_APP
-#include "huff_app_msgids.h"
-#include "huff_app_msgstruct.h"
-#endif
-
-#ifdef HAVE_CI_LAB
-#include "ci_lab_msgids.h"
-#endif
+ * --------------------------------------------
+ * Appends "len=<size> <hex>" to a line: the total message length and up to
+ * Stream->DumpBytes payload bytes following the telemetry header.
+ * --------------------------------------------
+ */
+static size_t TO_CON_StringfyDump(char *Dest, const CFE_SB_Buffer_t *SourceBuffer, const TO_CON_Stream_t *Stream)
+{
+    CFE_MSG_Size_t MsgSize = 0;
+    size_t         Value;
+    size_t         DumpLength;
+    size_t         Length;
+    char           Digits[5];
+    size_t         NumDigits = 0;
+
+    CFE_MSG_GetSize(&SourceBuffer->Msg, &MsgSize);
+
+    memcpy(Dest, "len=", 4);
+    Length = 4;
+
+    /* CCSDS sizes fit in five digits, which come out in reverse */
+    Value = MsgSize;
+    do
+    {
+        Digits[NumDigits++] = (char)('0' + (Value % 10));
+        Value /= 10;
+    } while (Value != 0 && NumDigits < sizeof(Digits));
+
+    while (NumDigits > 0)
+    {
+        Dest[Length++] = Digits[--NumDigits];
+    }
 
+    if (MsgSize <= sizeof(CFE_MSG_TelemetryHeader_t))
+    {
+        return Length;
+    }
 
+    DumpLength = MsgSize - sizeof(CFE_MSG_TelemetryHeader_t);
+    if (DumpLength > Stream->DumpBytes)
+    {
+        DumpLength = Stream->DumpBytes;
+    }
 
+    Dest[Length++] = ' ';
+    Length += TO_CON_HexEncode(&Dest[Length], (const uint8 *)SourceBuffer + sizeof(CFE_MSG_TelemetryHeader_t),
+                               DumpLength);
 
-#define MAX_TO_TEXT_PAYLOAD_BYTES 128
-#define MAX_TO_MSG_NAME_BYTES 32
-#define MAX_TO_MSG_TEXT_BYTES 128
+    return Length;
+}
 
 /*
  * --------------------------------------------
- * This implements an "encoder" that simply outputs the same pointer that was passed in.
- * This matches the traditional TO behavior where the "C" struct is passed directly to the socket.
+ * This implements an "encoder" that renders a one line text summary of the message.
  *
- * The only thing this needs to do get the real size of the output datagram, which should be
- * the size stored in the CFE message header.
+ * The MsgId is looked up in the decoder registry, which supplies the name printed
+ * for the message and, optionally, a decoder that renders part of its content.
+ * The caller supplies the timestamp so no clock is read here.
  * --------------------------------------------
  */
-CFE_Status_t TO_CON_StringfyOutputMessage(const CFE_SB_Buffer_t *SourceBuffer, const char **DestBufferOut,
-                                        size_t *DestSizeOut)
+CFE_Status_t TO_CON_StringfyOutputMessage(const CFE_SB_Buffer_t *SourceBuffer, const TO_CON_Stream_t *Stream,
+                                          int64 TimeMillis, const void **DestBufferOut, size_t *DestSizeOut)
 {
-    uint32_t                    MsgIdValue;
-    static char                 TextBuffer[MAX_TO_TEXT_PAYLOAD_BYTES];
-    static char                 MessageName[MAX_TO_MSG_NAME_BYTES];
-    static char                 MessageText[MAX_TO_MSG_TEXT_BYTES];
-    OS_time_t                   LocalTime;
-    int64                       NowTimeMillis;
-    size_t                      ActualLength;
-    size_t                      ExpectedLength;
-    CFE_SB_MsgId_t              MsgId = CFE_SB_INVALID_MSG_ID;
-    int32                       status;
-
-#ifdef HAVE_MXM_APP
-    const MXM_APP_ResultTlm_t*  MxmAppResultTlmPtr;
-#endif
-#ifdef HAVE_HUFF_APP
-    const HUFF_APP_ResultTlm_t* HuffAppResultTlmPtr;
-#endif
-
-    MessageText[0] = '\0';
+    uint32_t                     MsgIdValue;
+    static char                  TextBuffer[MAX_TO_TEXT_PREFIX_BYTES + MAX_TO_MSG_TEXT_BYTES + MAX_TO_DUMP_TEXT_BYTES];
+    char *                       MessageText;
+    const char *                 MessageName;
+    size_t                       ActualLength;
+    size_t                       TextLength;
+    CFE_SB_MsgId_t               MsgId = CFE_SB_INVALID_MSG_ID;
+    const TO_CON_DecoderEntry_t *Entry;
+    int32                        status;
+    int                          PrefixLength;
 
     CFE_MSG_GetMsgId(&SourceBuffer->Msg, &MsgId);
     MsgIdValue = CFE_SB_MsgIdToValue(MsgId);
 
-    switch (MsgIdValue) {
-        case TO_CON_HK_TLM_MID:
-            strncpy ( MessageName, "TO_HK", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_ES_HK_TLM_MID:
-            strncpy ( MessageName, "ES_HK", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_EVS_HK_TLM_MID:
-            strncpy ( MessageName, "EVS_HK", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_SB_HK_TLM_MID:
-            strncpy ( MessageName, "SB_HK", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_TBL_HK_TLM_MID:
-            strncpy ( MessageName, "TBL_HK", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_TIME_HK_TLM_MID:
-            strncpy ( MessageName, "TIME_HK", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_TIME_DIAG_TLM_MID:
-            strncpy ( MessageName, "TIME_DIAG", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_SB_STATS_TLM_MID:
-            strncpy ( MessageName, "SB_STATS", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_TBL_REG_TLM_MID:
-            strncpy ( MessageName, "TBL_REG", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_EVS_LONG_EVENT_MSG_MID:
-            strncpy ( MessageName, "EVS_LONG_EVENT", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_ES_APP_TLM_MID:
-            strncpy ( MessageName, "ES_APP", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case CFE_ES_MEMSTATS_TLM_MID:
-            strncpy ( MessageName, "ES_MEMSTATS", MAX_TO_MSG_NAME_BYTES);
-            break;
-#ifdef HAVE_MXM_APP
-        case MXM_APP_HK_TLM_MID:
-            strncpy ( MessageName, "MXM_HK", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case MXM_APP_RES_TLM_MID:
-            strncpy ( MessageName, "MXM_RES", MAX_TO_MSG_NAME_BYTES);
-            ExpectedLength = sizeof(MXM_APP_ResultTlm_t);
-            ActualLength = 0;
-            CFE_MSG_GetSize(&SourceBuffer->Msg, &ActualLength);
-            if (ActualLength == ExpectedLength)
-            {
-                MxmAppResultTlmPtr = (const MXM_APP_ResultTlm_t *)SourceBuffer;
-                status = CFE_SB_MessageStringGet(
-                    MessageText,
-                    MxmAppResultTlmPtr->Payload.ResultStr,
-                    NULL, 
-                    sizeof(MessageText),
-                    sizeof(MxmAppResultTlmPtr->Payload.ResultStr));
-                if (status == CFE_SB_BAD_ARGUMENT) {
-                    CFE_EVS_SendEvent(TO_CON_ENCODE_ERR_EID, CFE_EVS_EventType_ERROR,
-                            "Failed retrieve message content: 0x%08lx", (unsigned long)status);
-                }
-            }
-            else
+    Entry       = TO_CON_RegistryLookup(MsgId);
+    MessageName = (Entry == NULL) ? "unknown" : Entry->Name;
+
+    PrefixLength = snprintf(TextBuffer, MAX_TO_TEXT_PREFIX_BYTES, "%lu %04lx %s ", (unsigned long)TimeMillis,
+                            (unsigned long)MsgIdValue, MessageName);
+    if (PrefixLength < 0)
+    {
+        PrefixLength = 0;
+    }
+    else if (PrefixLength >= MAX_TO_TEXT_PREFIX_BYTES)
+    {
+        PrefixLength = MAX_TO_TEXT_PREFIX_BYTES - 1;
+    }
+
+    /* Decoders write straight into the line, after the prefix */
+    TextLength     = (size_t)PrefixLength;
+    MessageText    = &TextBuffer[TextLength];
+    MessageText[0] = '\0';
+
+    if (Entry != NULL && (Entry->Layout != NULL || Entry->DecodeFunc != NULL))
+    {
+        ActualLength = 0;
+        CFE_MSG_GetSize(&SourceBuffer->Msg, &ActualLength);
+
+        if (Entry->Layout != NULL)
+        {
+            if (ActualLength < Entry->Layout->MinSize)
             {
                 CFE_EVS_SendEvent(TO_CON_ENCODE_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Invalid Msg length: ID = 0x%X,  Len = %u, Expected = %u",
-                          (unsigned int)MsgIdValue, 
-                          (unsigned int)ActualLength,
-                          (unsigned int)ExpectedLength);
+                                  "Invalid Msg length: ID = 0x%X,  Len = %u, Expected at least %u",
+                                  (unsigned int)MsgIdValue, (unsigned int)ActualLength,
+                                  (unsigned int)Entry->Layout->MinSize);
             }
-            break;
-#endif
-#ifdef HAVE_HUFF_APP
-        case HUFF_APP_HK_TLM_MID:
-            strncpy ( MessageName, "HUFF_HK", MAX_TO_MSG_NAME_BYTES);
-            break;
-        case HUFF_APP_RES_TLM_MID:
-            strncpy ( MessageName, "HUFF_RES", MAX_TO_MSG_NAME_BYTES);
-            ExpectedLength = sizeof(HUFF_APP_ResultTlm_t);
-            ActualLength = 0;
-            CFE_MSG_GetSize(&SourceBuffer->Msg, &ActualLength);
-            if (ActualLength == ExpectedLength)
+            else
             {
-                HuffAppResultTlmPtr = (const HUFF_APP_ResultTlm_t *)SourceBuffer;
-                status = CFE_SB_MessageStringGet(
-                    MessageText,
-                    HuffAppResultTlmPtr->Payload.ResultStr,
-                    NULL, 
-                    sizeof(MessageText),
-                    sizeof(HuffAppResultTlmPtr->Payload.ResultStr));
-                if (status == CFE_SB_BAD_ARGUMENT) {
-                    CFE_EVS_SendEvent(TO_CON_ENCODE_ERR_EID, CFE_EVS_EventType_ERROR,
-                            "Failed retrieve message content: 0x%08lx", (unsigned long)status);
-                }
+                TextLength += TO_CON_RenderFields(Entry->Layout, SourceBuffer, MessageText, MAX_TO_MSG_TEXT_BYTES);
             }
-            else
+        }
+        else if (Entry->ExpectedSize != 0 && ActualLength != Entry->ExpectedSize)
+        {
+            CFE_EVS_SendEvent(TO_CON_ENCODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid Msg length: ID = 0x%X,  Len = %u, Expected = %u", (unsigned int)MsgIdValue,
+                              (unsigned int)ActualLength, (unsigned int)Entry->ExpectedSize);
+        }
+        else
+        {
+            status = Entry->DecodeFunc(SourceBuffer, MessageText, MAX_TO_MSG_TEXT_BYTES);
+            if (status != CFE_SUCCESS)
             {
                 CFE_EVS_SendEvent(TO_CON_ENCODE_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Invalid Msg length: ID = 0x%X,  Len = %u, Expected = %u",
-                          (unsigned int)MsgIdValue, 
-                          (unsigned int)ActualLength,
-                          (unsigned int)ExpectedLength);
+                                  "Failed retrieve message content: 0x%08lx", (unsigned long)status);
+                MessageText[0] = '\0';
             }
-            break;
-#endif
-        default:
-            strncpy ( MessageName, "unknown", MAX_TO_MSG_NAME_BYTES );
+            TextLength += strlen(MessageText);
+        }
+    }
+    else if (Stream != NULL && Stream->DumpBytes != 0)
+    {
+        /* Packets nothing can decode may still be identified from their payload */
+        TextLength += TO_CON_StringfyDump(MessageText, SourceBuffer, Stream);
     }
-    MessageName[MAX_TO_MSG_NAME_BYTES-1] = '\0';
-
-    memset(&LocalTime, 0, sizeof(LocalTime));
-    CFE_PSP_GetTime(&LocalTime);
-    NowTimeMillis = OS_TimeGetTotalMilliseconds(LocalTime);
 
-    //ResultStatus = CFE_MSG_GetSize(&SourceBuffer->Msg, &SourceBufferSize);
-    snprintf(TextBuffer, MAX_TO_TEXT_PAYLOAD_BYTES, "%lu %04lx %s %s",
-        (unsigned long)NowTimeMillis,
-        (unsigned long)MsgIdValue,
-        MessageName,
-        MessageText
-    );
-    TextBuffer[MAX_TO_TEXT_PAYLOAD_BYTES-1] = '\0';
+    TextBuffer[TextLength++] = '\n';
 
     *DestBufferOut = TextBuffer;
-    *DestSizeOut   = strlen(TextBuffer);
+    *DestSizeOut   = TextLength;
 
     return CFE_SUCCESS;
 }
@@ -0,0 +1,164 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *  This file contains the TO Console UDP output
+ *
+ *  When enabled by TO_CON_ENABLE_OUTPUT_CC, the UDP sink's writer task
+ *  sends each batch queued for it to the commanded address on
+ *  TO_CON_TLM_PORT.  A batch is already one contiguous run of whole lines
+ *  or frames, so each datagram is a slice of it holding as many as fit in
+ *  TO_CON_UDP_MTU, sent straight from the batch buffer.
+ */
+
+#include "cfe.h"
+
+#include "to_con_app.h"
+#include "to_con_udp.h"
+#include "to_con_eventids.h"
+
+#define TO_CON_UDP_MUTEX_NAME "TO_CON_UDP_MUT"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_UdpInit() -- Open the output socket, initially disabled  */
+/*                                                                 */
+/* Without a socket UDP output cannot be enabled, but the rest of  */
+/* TO_CON works, so errors are only reported.                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_UdpInit(void)
+{
+    TO_CON_Udp_t *Udp = &TO_CON_Global.Udp;
+    int32         OsStatus;
+
+    memset(Udp, 0, sizeof(*Udp));
+    Udp->Socket = OS_OBJECT_ID_UNDEFINED;
+
+    OsStatus = OS_MutSemCreate(&Udp->Mutex, TO_CON_UDP_MUTEX_NAME, 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(TO_CON_UDP_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Can't create UDP mutex status %i",
+                          __LINE__, (int)OsStatus);
+        return;
+    }
+
+    OsStatus = OS_SocketOpen(&Udp->Socket, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    if (OsStatus != OS_SUCCESS)
+    {
+        Udp->Socket = OS_OBJECT_ID_UNDEFINED;
+        CFE_EVS_SendEvent(TO_CON_UDP_ERR_EID, CFE_EVS_EventType_ERROR, "L%d TO Can't open UDP socket status %i",
+                          __LINE__, (int)OsStatus);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_UdpSetDestination() -- Start, move or stop UDP output    */
+/*                                                                 */
+/* An empty DestIP stops it.  Called from the TO_CON main task.    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t TO_CON_UdpSetDestination(const char *DestIP)
+{
+    TO_CON_Udp_t *Udp = &TO_CON_Global.Udp;
+    OS_SockAddr_t Addr;
+    bool          Enabled = (DestIP[0] != '\0');
+
+    if (!OS_ObjectIdDefined(Udp->Socket))
+    {
+        return CFE_STATUS_INCORRECT_STATE;
+    }
+
+    memset(&Addr, 0, sizeof(Addr));
+    if (Enabled && (OS_SocketAddrInit(&Addr, OS_SocketDomain_INET) != OS_SUCCESS ||
+                    OS_SocketAddrFromString(&Addr, DestIP) != OS_SUCCESS ||
+                    OS_SocketAddrSetPort(&Addr, TO_CON_TLM_PORT) != OS_SUCCESS))
+    {
+        return CFE_STATUS_RANGE_ERROR;
+    }
+
+    OS_MutSemTake(Udp->Mutex);
+    Udp->PendingEnabled = Enabled;
+    Udp->PendingAddr    = Addr;
+    __atomic_store_n(&Udp->RequestCount, Udp->RequestCount + 1, __ATOMIC_RELEASE);
+    OS_MutSemGive(Udp->Mutex);
+
+    /* Nothing is queued for the UDP sink while it is stopped */
+    TO_CON_Global.Output.Sinks[TO_CON_SINK_UDP].Enabled = Enabled;
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_CON_UdpSend() -- Send one output batch as datagrams          */
+/*                                                                 */
+/* Data holds Count lines or frames back to back, Lengths[i] bytes */
+/* each.  None is ever split between datagrams.  Called from the   */
+/* UDP sink's writer task.                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_CON_UdpSend(const char *Data, const uint16 *Lengths, uint32 Count)
+{
+    TO_CON_Udp_t *Udp = &TO_CON_Global.Udp;
+    uint32        Requested;
+    size_t        Start = 0;
+    size_t        End   = 0;
+    uint32        i;
+    int32         OsStatus;
+
+    Requested = __atomic_load_n(&Udp->RequestCount, __ATOMIC_ACQUIRE);
+    if (Requested != Udp->AppliedCount)
+    {
+        OS_MutSemTake(Udp->Mutex);
+        Udp->Enabled      = Udp->PendingEnabled;
+        Udp->Addr         = Udp->PendingAddr;
+        Udp->AppliedCount = Udp->RequestCount;
+        OS_MutSemGive(Udp->Mutex);
+
+        Udp->ErrorReported = false;
+    }
+
+    if (!Udp->Enabled)
+    {
+        return;
+    }
+
+    for (i = 0; i <= Count; i++)
+    {
+        /* Send what is gathered when the next one would overflow it, and at the end */
+        if (End > Start && (i == Count || (End + Lengths[i] - Start) > TO_CON_UDP_MTU))
+        {
+            OsStatus = OS_SocketSendTo(Udp->Socket, &Data[Start], End - Start, &Udp->Addr);
+            if (OsStatus < 0 && !Udp->ErrorReported)
+            {
+                CFE_EVS_SendEvent(TO_CON_UDP_ERR_EID, CFE_EVS_EventType_ERROR, "TO UDP send failed status %i",
+                                  (int)OsStatus);
+                Udp->ErrorReported = true;
+            }
+            Start = End;
+        }
+
+        if (i < Count)
+        {
+            End += Lengths[i];
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Define TO Console UDP output
+ */
+
+#ifndef TO_CON_UDP_H
+#define TO_CON_UDP_H
+
+#include "common_types.h"
+#include "osapi.h"
+#include "cfe.h"
+
+#include "to_con_platform_cfg.h"
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/**
+ * UDP output state
+ *
+ * The destination is set by command in the TO_CON main task and used by
+ * the writer task.  A new destination is left in Pending* under Mutex
+ * and RequestCount is bumped; the writer task takes it over when it sees
+ * the count change, so sending never takes the mutex.
+ */
+typedef struct
+{
+    osal_id_t Socket;
+    osal_id_t Mutex;
+
+    uint32        RequestCount;
+    bool          PendingEnabled;
+    OS_SockAddr_t PendingAddr;
+
+    /* Writer task only */
+    uint32        AppliedCount;
+    bool          Enabled;
+    bool          ErrorReported; /**< A send error was reported since the destination was set */
+    OS_SockAddr_t Addr;
+} TO_CON_Udp_t;
+
+/************************************************************************
+ * Function Prototypes
+ ************************************************************************/
+
+void         TO_CON_UdpInit(void);
+CFE_Status_t TO_CON_UdpSetDestination(const char *DestIP);
+void         TO_CON_UdpSend(const char *Data, const uint16 *Lengths, uint32 Count);
+
+#endif